@@ -0,0 +1,5 @@
+#include "src/benchmarks.cpp"
+
+int main(int argc, char *argv[]) {
+    return RunBenchmarks(argc, argv);
+}
@@ -0,0 +1,130 @@
+#ifndef MERGEABLE_HEAPS_BENCHMARK_H
+#define MERGEABLE_HEAPS_BENCHMARK_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// Sizes of the generated workloads. Can be overridden from the command line.
+struct BenchmarkConfig {
+    size_t keys_cnt_ = 1'000'000;
+    // Number of edges of the generated graphs
+    size_t edges_cnt_ = 1'000'000;
+    uint32_t seed_ = 42;
+};
+
+// Accumulates results of the workloads, so the compiler can't throw them away.
+inline uint64_t benchmark_sink = 0;
+
+// Measures wall time of the call in milliseconds.
+template<class F>
+double MeasureMilliseconds(F &&f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto finish = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(finish - start).count();
+}
+
+// Measures wall time of the call in nanoseconds.
+template<class F>
+uint64_t MeasureNanoseconds(F &&f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto finish = std::chrono::steady_clock::now();
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count());
+}
+
+// Prints the header of a benchmark suite.
+inline void PrintSuite(const std::string &suite) {
+    std::printf("\n== %s ==\n", suite.c_str());
+    std::printf("%-28s %-20s %12s\n", "heap", "workload", "ms");
+}
+
+// Prints one row of the result table.
+inline void PrintResult(const std::string &heap, const std::string &workload, double milliseconds) {
+    std::printf("%-28s %-20s %12.2f\n", heap.c_str(), workload.c_str(), milliseconds);
+}
+
+// Counts the mispredicted branches of the call in the user space.
+// Returns -1, if the hardware counter is not available, e.g. in a virtual machine.
+template<class F>
+int64_t CountBranchMisses(F &&f) {
+    perf_event_attr attr{};
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    const int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    if (fd < 0) {
+        f();
+        return -1;
+    }
+    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    f();
+    ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    int64_t misses = -1;
+    if (read(fd, &misses, sizeof(misses)) != sizeof(misses)) {
+        misses = -1;
+    }
+    close(fd);
+    return misses;
+}
+
+// Prints the header of a suite with the branch misses.
+inline void PrintBranchSuite(const std::string &suite) {
+    std::printf("\n== %s ==\n", suite.c_str());
+    std::printf("%-28s %-20s %12s %16s\n", "heap", "workload", "ms", "branch misses");
+}
+
+// Prints one row with the wall time and the branch misses, "n/a" if they weren't counted.
+inline void PrintBranchResult(const std::string &heap, const std::string &workload, double milliseconds,
+                              int64_t misses) {
+    if (misses < 0) {
+        std::printf("%-28s %-20s %12.2f %16s\n", heap.c_str(), workload.c_str(), milliseconds, "n/a");
+    } else {
+        std::printf("%-28s %-20s %12.2f %16lld\n", heap.c_str(), workload.c_str(), milliseconds,
+                    static_cast<long long>(misses));
+    }
+}
+
+// Prints the header of a suite of per-operation latencies.
+inline void PrintLatencySuite(const std::string &suite) {
+    std::printf("\n== %s ==\n", suite.c_str());
+    std::printf("%-28s %-20s %10s %10s %10s %10s\n", "heap", "workload", "p50 ns", "p99 ns", "p99.9 ns", "max ns");
+}
+
+// Prints the percentiles of the per-operation latencies. The samples are sorted.
+inline void PrintLatencies(const std::string &heap, const std::string &workload, std::vector<uint64_t> &samples) {
+    if (samples.empty()) {
+        return;
+    }
+    std::sort(samples.begin(), samples.end());
+    auto percentile = [&samples](double q) {
+        return static_cast<unsigned long long>(samples[static_cast<size_t>(q * static_cast<double>(samples.size() - 1))]);
+    };
+    std::printf("%-28s %-20s %10llu %10llu %10llu %10llu\n", heap.c_str(), workload.c_str(),
+                percentile(0.5), percentile(0.99), percentile(0.999), percentile(1.0));
+}
+
+// Generates n uniformly distributed keys.
+inline std::vector<int> RandomKeys(size_t n, uint32_t seed) {
+    std::mt19937 gen(seed);
+    std::vector<int> keys(n);
+    for (auto &key: keys) {
+        key = static_cast<int>(gen());
+    }
+    return keys;
+}
+
+#endif // MERGEABLE_HEAPS_BENCHMARK_H
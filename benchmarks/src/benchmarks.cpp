@@ -0,0 +1,951 @@
+#include <array>
+#include <cstdlib>
+#include <set>
+#include <sys/wait.h>
+#include "benchmark.h"
+#include "workloads.h"
+#include "graphs.h"
+#include "mergeable_heaps/binomial_heap.h"
+#include "mergeable_heaps/root_table_binomial_heap.h"
+#include "mergeable_heaps/lazy_binomial_heap.h"
+#include "mergeable_heaps/skew_binomial_heap.h"
+#include "mergeable_heaps/leftist_heap.h"
+#include "mergeable_heaps/skew_heap.h"
+#include "mergeable_heaps/weight_biased_leftist_heap.h"
+#include "mergeable_heaps/deamortized_skew_heap.h"
+#include "mergeable_heaps/randomized_meldable_heap.h"
+#include "mergeable_heaps/blocked_leftist_heap.h"
+#include "mergeable_heaps/blocked_skew_heap.h"
+#include "mergeable_heaps/radix_heap.h"
+#include "mergeable_heaps/soft_heap.h"
+#include "mergeable_heaps/soft_select.h"
+#include "mergeable_heaps/algorithms/dijkstra.h"
+#include "mergeable_heaps/algorithms/prim.h"
+#include "mergeable_heaps/algorithms/huffman.h"
+#include "mergeable_heaps/algorithms/kway_merge.h"
+#include "mergeable_heaps/algorithms/arborescence.h"
+#include "mergeable_heaps/work_stealing_scheduler.h"
+#include "shared_heap_pool.h"
+#include "mergeable_heaps/timer_queue.h"
+#include "timing_wheel.h"
+#include "mergeable_heaps/double_ended_heap.h"
+#include "mergeable_heaps/tombstone_heap.h"
+#include "mergeable_heaps/conversion.h"
+#include "mergeable_heaps/payload_heap.h"
+#include "mergeable_heaps/bounded_heap.h"
+#include "mergeable_heaps/normalized_key.h"
+#include "mergeable_heaps/priority_channel.h"
+#include "mergeable_heaps/shared_memory_heap.h"
+#include "../../tests/src/naive_heap.h"
+
+// Binomial heap with a linked list of roots against the one with the degree-indexed table
+// and the lazy one, which postpones consolidation until ExtractMinimum.
+void BinomialRootsSuite(const BenchmarkConfig &config) {
+    auto keys = RandomKeys(config.keys_cnt_, config.seed_);
+    PrintSuite("Binomial heap variants");
+    RunStandardWorkloads<heaps::BinomialHeap<int>>("BinomialHeap", keys);
+    RunStandardWorkloads<heaps::RootTableBinomialHeap<int>>("RootTableBinomialHeap", keys);
+    RunStandardWorkloads<heaps::LazyBinomialHeap<int>>("LazyBinomialHeap", keys);
+    RunStandardWorkloads<heaps::LeftistHeap<int>>("LeftistHeap", keys);
+    RunStandardWorkloads<heaps::SkewHeap<int>>("SkewHeap", keys);
+}
+
+// Heaps with one key per node against the ones storing blocks of keys.
+void BlockedNodesSuite(const BenchmarkConfig &config) {
+    auto keys = RandomKeys(config.keys_cnt_, config.seed_);
+    PrintSuite("Blocked nodes, int keys");
+    RunStandardWorkloads<heaps::LeftistHeap<int>>("LeftistHeap", keys);
+    RunStandardWorkloads<heaps::BlockedLeftistHeap<int, 8>>("BlockedLeftistHeap<8>", keys);
+    RunStandardWorkloads<heaps::BlockedLeftistHeap<int, 16>>("BlockedLeftistHeap<16>", keys);
+    RunStandardWorkloads<heaps::SkewHeap<int>>("SkewHeap", keys);
+    RunStandardWorkloads<heaps::BlockedSkewHeap<int, 8>>("BlockedSkewHeap<8>", keys);
+    RunStandardWorkloads<heaps::BlockedSkewHeap<int, 16>>("BlockedSkewHeap<16>", keys);
+}
+
+// Per-entity queues under 16 keys: node-based heaps against the ones with the inline buffer.
+void InlineBufferSuite(const BenchmarkConfig &config) {
+    auto keys = RandomKeys(config.keys_cnt_, config.seed_);
+    PrintSuite("Tiny heaps, inline buffer");
+    auto run = [&](const std::string &name, auto workload) {
+        PrintResult(name, "tiny heaps", MeasureMilliseconds([&] {
+            benchmark_sink += workload(keys);
+        }));
+    };
+    run("LeftistHeap", TinyHeaps<heaps::LeftistHeap<int>, int>);
+    run("LeftistHeap<16 inline>", TinyHeaps<heaps::LeftistHeap<int, 16>, int>);
+    run("SkewHeap", TinyHeaps<heaps::SkewHeap<int>, int>);
+    run("SkewHeap<16 inline>", TinyHeaps<heaps::SkewHeap<int, 16>, int>);
+    run("BinomialHeap", TinyHeaps<heaps::BinomialHeap<int>, int>);
+    run("BinomialHeap<16 inline>", TinyHeaps<heaps::BinomialHeap<int, 16>, int>);
+}
+
+// Monotone integer priorities: radix heap against the comparison-based tree heaps.
+void MonotonePrioritiesSuite(const BenchmarkConfig &config) {
+    using Item = std::pair<uint32_t, uint32_t>;
+    PrintSuite("Monotone priorities, event simulation");
+    auto run = [&](const std::string &name, auto workload) {
+        PrintResult(name, "events", MeasureMilliseconds([&] {
+            benchmark_sink += workload(config.keys_cnt_, config.seed_);
+        }));
+    };
+    run("RadixHeap", MonotoneEvents<heaps::RadixHeap<uint32_t, uint32_t>, uint32_t>);
+    run("LeftistHeap", MonotoneEvents<heaps::LeftistHeap<Item>, uint32_t>);
+    run("SkewHeap", MonotoneEvents<heaps::SkewHeap<Item>, uint32_t>);
+    run("BinomialHeap", MonotoneEvents<heaps::BinomialHeap<Item>, uint32_t>);
+    run("LazyBinomialHeap", MonotoneEvents<heaps::LazyBinomialHeap<Item>, uint32_t>);
+}
+
+// Selects the k-th smallest key with an exact heap: inserts all the keys and extracts k of them.
+template<class Heap>
+int SelectWithHeap(const std::vector<int> &keys, size_t k) {
+    Heap heap;
+    for (int key: keys) {
+        heap.Insert(key);
+    }
+    for (size_t i = 0; i < k; ++i) {
+        heap.ExtractMinimum();
+    }
+    return heap.GetMinimum();
+}
+
+// Median selection: soft-heap selection against std::nth_element and the exact heaps.
+void SelectionSuite(const BenchmarkConfig &config) {
+    auto keys = RandomKeys(config.keys_cnt_, config.seed_);
+    const size_t k = keys.size() / 2;
+    PrintSuite("Selection of the median");
+    auto run = [&](const std::string &name, auto select) {
+        PrintResult(name, "select", MeasureMilliseconds([&] {
+            benchmark_sink += static_cast<uint32_t>(select());
+        }));
+    };
+    run("SoftSelect", [&] { return heaps::SoftSelect(keys, k); });
+    run("std::nth_element", [&] {
+        auto copy = keys;
+        std::nth_element(copy.begin(), copy.begin() + static_cast<std::ptrdiff_t>(k), copy.end());
+        return copy[k];
+    });
+    run("LeftistHeap", [&] { return SelectWithHeap<heaps::LeftistHeap<int>>(keys, k); });
+    run("SkewHeap", [&] { return SelectWithHeap<heaps::SkewHeap<int>>(keys, k); });
+    run("LazyBinomialHeap", [&] { return SelectWithHeap<heaps::LazyBinomialHeap<int>>(keys, k); });
+    // Approximate ordering itself: the same extractions from the soft heap, the answer may be corrupted.
+    run("SoftHeap(1/8), approximate", [&] { return SelectWithHeap<heaps::SoftHeap<int>>(keys, k); });
+}
+
+// Inputs of the graph algorithms, generated once for all the heaps.
+struct GraphInputs {
+    size_t random_vertices_cnt_, grid_vertices_cnt_;
+    std::vector<heaps::Edge<int64_t>> random_edges_;
+    heaps::CsrGraph<int64_t> random_, random_undirected_, grid_;
+    std::vector<uint64_t> frequencies_;
+    std::vector<std::vector<int>> runs_;
+};
+
+GraphInputs MakeGraphInputs(const BenchmarkConfig &config) {
+    size_t random_cnt = 0, grid_cnt = 0;
+    auto random_edges = RandomGraph(config.edges_cnt_, config.seed_, random_cnt);
+    auto grid_edges = GridGraph(config.edges_cnt_, config.seed_, grid_cnt);
+    GraphInputs inputs{random_cnt, grid_cnt, random_edges,
+                       heaps::CsrGraph<int64_t>(random_cnt, random_edges),
+                       heaps::CsrGraph<int64_t>(random_cnt, random_edges, true),
+                       heaps::CsrGraph<int64_t>(grid_cnt, grid_edges), {}, {}};
+    // Zipf-like frequencies of the symbols
+    std::mt19937 gen(config.seed_);
+    inputs.frequencies_.resize(config.keys_cnt_);
+    for (size_t i = 0; i < inputs.frequencies_.size(); ++i) {
+        inputs.frequencies_[i] = 1'000'000'000 / (i + 1) + gen() % 16;
+    }
+    // 1024 sorted runs
+    auto keys = RandomKeys(config.keys_cnt_, config.seed_);
+    inputs.runs_.resize(1024);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        inputs.runs_[i % inputs.runs_.size()].push_back(keys[i]);
+    }
+    for (auto &run: inputs.runs_) {
+        std::sort(run.begin(), run.end());
+    }
+    return inputs;
+}
+
+template<template<class> class Heap>
+void RunGraphAlgorithms(const std::string &name, const GraphInputs &inputs) {
+    PrintResult(name, "dijkstra random", MeasureMilliseconds([&] {
+        benchmark_sink += static_cast<uint64_t>(heaps::Dijkstra<Heap>(inputs.random_, 0).back());
+    }));
+    PrintResult(name, "dijkstra grid", MeasureMilliseconds([&] {
+        benchmark_sink += static_cast<uint64_t>(heaps::Dijkstra<Heap>(inputs.grid_, 0).back());
+    }));
+    PrintResult(name, "prim", MeasureMilliseconds([&] {
+        benchmark_sink += static_cast<uint64_t>(heaps::Prim<Heap>(inputs.random_undirected_).weight_);
+    }));
+    PrintResult(name, "arborescence", MeasureMilliseconds([&] {
+        benchmark_sink += static_cast<uint64_t>(heaps::MinimumArborescence<Heap>(
+                inputs.random_vertices_cnt_, inputs.random_edges_, 0));
+    }));
+    PrintResult(name, "huffman", MeasureMilliseconds([&] {
+        benchmark_sink += heaps::HuffmanCodeLengths<Heap>(inputs.frequencies_).back();
+    }));
+    PrintResult(name, "k-way merge", MeasureMilliseconds([&] {
+        benchmark_sink += static_cast<uint64_t>(heaps::KWayMerge<Heap>(inputs.runs_).back());
+    }));
+}
+
+// Graph and greedy algorithms with every heap. The number of edges is the second command line argument.
+void GraphAlgorithmsSuite(const BenchmarkConfig &config) {
+    auto inputs = MakeGraphInputs(config);
+    PrintSuite("Graph algorithms, " + std::to_string(config.edges_cnt_) + " edges");
+    RunGraphAlgorithms<heaps::BinomialHeap>("BinomialHeap", inputs);
+    RunGraphAlgorithms<heaps::LazyBinomialHeap>("LazyBinomialHeap", inputs);
+    RunGraphAlgorithms<heaps::LeftistHeap>("LeftistHeap", inputs);
+    RunGraphAlgorithms<heaps::SkewHeap>("SkewHeap", inputs);
+    RunGraphAlgorithms<heaps::StlHeap>("StlHeap", inputs);
+}
+
+// Fork-join tree of about n tiny tasks, every task submits two children with a higher priority.
+template<class Pool>
+void ForkJoin(Pool &pool, size_t n) {
+    int depth = 0;
+    while ((size_t(2) << depth) <= n) {
+        ++depth;
+    }
+    std::atomic<uint64_t> sum{0};
+    std::function<void(int, uint64_t)> spawn = [&](int level, uint64_t value) {
+        sum.fetch_add(value, std::memory_order_relaxed);
+        if (level > 0) {
+            pool.Submit(depth - level, [&spawn, level, value] { spawn(level - 1, 2 * value); });
+            pool.Submit(depth - level, [&spawn, level, value] { spawn(level - 1, 2 * value + 1); });
+        }
+    };
+    pool.Submit(0, [&] { spawn(depth - 1, 1); });
+    pool.Wait();
+    benchmark_sink += sum;
+}
+
+// Per-worker mergeable queues with subtree stealing against one heap shared under a lock.
+void WorkStealingSuite(const BenchmarkConfig &config) {
+    const size_t workers_cnt = std::max<size_t>(std::thread::hardware_concurrency(), 2);
+    PrintSuite("Task scheduling, " + std::to_string(workers_cnt) + " workers");
+    auto run_stealing = [&](const std::string &name, auto &&scheduler) {
+        PrintResult(name, "fork-join", MeasureMilliseconds([&] {
+            ForkJoin(scheduler, config.keys_cnt_);
+        }));
+        size_t steals = 0, stolen = 0;
+        for (size_t i = 0; i < scheduler.WorkersCount(); ++i) {
+            steals += scheduler.StealCount(i);
+            stolen += scheduler.StolenTasks(i);
+        }
+        std::printf("%-28s steals %zu, stolen tasks %zu\n", "", steals, stolen);
+    };
+    run_stealing("WorkStealing<LeftistHeap>", heaps::WorkStealingScheduler<heaps::LeftistHeap>(workers_cnt));
+    run_stealing("WorkStealing<SkewHeap>", heaps::WorkStealingScheduler<heaps::SkewHeap>(workers_cnt));
+    SharedHeapPool pool(workers_cnt);
+    PrintResult("SharedHeapPool", "fork-join", MeasureMilliseconds([&] {
+        ForkJoin(pool, config.keys_cnt_);
+    }));
+}
+
+// Cancel-heavy connection timeouts: timer queues on the heaps against the hashed timing wheel.
+void TimersSuite(const BenchmarkConfig &config) {
+    PrintSuite("Timers, cancel-heavy");
+    auto run = [&](const std::string &name, auto workload) {
+        PrintResult(name, "timeouts", MeasureMilliseconds([&] {
+            benchmark_sink += workload(config.keys_cnt_, config.seed_);
+        }));
+    };
+    run("TimerQueue<LazyBinomialHeap>", CancelHeavyTimers<heaps::TimerQueue<uint64_t, uint32_t>>);
+    run("TimerQueue<LeftistHeap>",
+        CancelHeavyTimers<heaps::TimerQueue<uint64_t, uint32_t, heaps::LeftistHeap>>);
+    run("TimerQueue<SkewHeap>", CancelHeavyTimers<heaps::TimerQueue<uint64_t, uint32_t, heaps::SkewHeap>>);
+    run("HashedTimingWheel", CancelHeavyTimers<HashedTimingWheel<uint32_t>>);
+}
+
+// Load shedding: the queue serves the smallest keys and evicts the largest ones, when it's over the limit.
+void DoubleEndedSuite(const BenchmarkConfig &config) {
+    auto keys = RandomKeys(config.keys_cnt_, config.seed_);
+    constexpr size_t kLimit = 1 << 16;
+    PrintSuite("Double-ended queue, load shedding");
+    PrintResult("DoubleEndedHeap", "serve+evict", MeasureMilliseconds([&] {
+        heaps::DoubleEndedHeap<int> heap;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            heap.Insert(keys[i]);
+            if (heap.Size() > kLimit) {
+                benchmark_sink += static_cast<uint32_t>(heap.GetMaximum());
+                heap.ExtractMaximum();
+            }
+            if (i % 2 == 0) {
+                benchmark_sink += static_cast<uint32_t>(heap.GetMinimum());
+                heap.ExtractMinimum();
+            }
+        }
+    }));
+    PrintResult("std::multiset", "serve+evict", MeasureMilliseconds([&] {
+        std::multiset<int> set;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            set.insert(keys[i]);
+            if (set.size() > kLimit) {
+                benchmark_sink += static_cast<uint32_t>(*set.rbegin());
+                set.erase(std::prev(set.end()));
+            }
+            if (i % 2 == 0) {
+                benchmark_sink += static_cast<uint32_t>(*set.begin());
+                set.erase(set.begin());
+            }
+        }
+    }));
+}
+
+// Jobs of 64 tenants, every 1024 insertions one tenant is cancelled with EraseIf.
+template<template<class> class Heap>
+uint64_t CancelTenants(const std::vector<int> &keys) {
+    heaps::TombstoneHeap<int, Heap> heap;
+    uint64_t checksum = 0;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        heap.Insert(keys[i]);
+        if (i % 1024 == 1023) {
+            const int tenant = keys[i] & 63;
+            checksum += heap.EraseIf([tenant](int key) { return (key & 63) == tenant; });
+        }
+        if (i % 4 == 0) {
+            checksum += static_cast<uint32_t>(heap.GetMinimum());
+            heap.ExtractMinimum();
+        }
+    }
+    return checksum + heap.DeadCount();
+}
+
+// Bulk invalidation of the queued items with tombstones and compaction.
+void TombstonesSuite(const BenchmarkConfig &config) {
+    auto keys = RandomKeys(config.keys_cnt_, config.seed_);
+    PrintSuite("Tombstones, tenant cancellation");
+    auto run = [&](const std::string &name, auto workload) {
+        PrintResult(name, "cancel tenants", MeasureMilliseconds([&] {
+            benchmark_sink += workload(keys);
+        }));
+    };
+    run("Tombstone<LeftistHeap>", CancelTenants<heaps::LeftistHeap>);
+    run("Tombstone<SkewHeap>", CancelTenants<heaps::SkewHeap>);
+    run("Tombstone<BinomialHeap>", CancelTenants<heaps::BinomialHeap>);
+}
+
+// Converts a heap of random keys to the target type, by ConvertTo or by draining and inserting one by one.
+template<class Source, class Target>
+void RunConversion(const std::string &name, const std::vector<int> &keys) {
+    auto fill = [&keys](Source &heap) {
+        for (int key: keys) {
+            heap.Insert(key);
+        }
+    };
+    Source source;
+    fill(source);
+    PrintResult(name, "ConvertTo", MeasureMilliseconds([&] {
+        Target target = heaps::ConvertTo<Target>(source);
+        benchmark_sink += static_cast<uint32_t>(target.GetMinimum());
+    }));
+    fill(source);
+    PrintResult(name, "drain+insert", MeasureMilliseconds([&] {
+        Target target;
+        while (!source.Empty()) {
+            target.Insert(source.GetMinimum());
+            source.ExtractMinimum();
+        }
+        benchmark_sink += static_cast<uint32_t>(target.GetMinimum());
+    }));
+}
+
+// Moving the keys between the heaps of different types.
+void ConversionSuite(const BenchmarkConfig &config) {
+    auto keys = RandomKeys(config.keys_cnt_, config.seed_);
+    PrintSuite("Cross-type conversion");
+    RunConversion<heaps::LeftistHeap<int>, heaps::BinomialHeap<int>>("Leftist -> Binomial", keys);
+    RunConversion<heaps::BinomialHeap<int>, heaps::SkewHeap<int>>("Binomial -> Skew", keys);
+    RunConversion<heaps::SkewHeap<int>, heaps::LeftistHeap<int>>("Skew -> Leftist", keys);
+}
+
+// Request object with a large body, ordered by the priority only.
+struct Request {
+    int priority_;
+    std::array<char, 120> body_;
+
+    bool operator<(const Request &other) const {
+        return priority_ < other.priority_;
+    }
+};
+
+// Keys with large payloads stored in the nodes against the priority-only nodes with a payload slab.
+// 64 heaps are filled, melded into one and drained.
+void PayloadSuite(const BenchmarkConfig &config) {
+    auto keys = RandomKeys(config.keys_cnt_, config.seed_);
+    constexpr size_t kHeapsCnt = 64;
+    PrintSuite("Large payloads, " + std::to_string(sizeof(Request)) + " bytes");
+    PrintResult("LeftistHeap<Request>", "fill+meld+drain", MeasureMilliseconds([&] {
+        std::vector<heaps::LeftistHeap<Request>> heaps(kHeapsCnt);
+        for (size_t i = 0; i < keys.size(); ++i) {
+            Request request{keys[i], {}};
+            request.body_[0] = static_cast<char>(i);
+            heaps[i % kHeapsCnt].Insert(request);
+        }
+        for (size_t i = 1; i < kHeapsCnt; ++i) {
+            heaps[0].Merge(heaps[i]);
+        }
+        while (!heaps[0].Empty()) {
+            benchmark_sink += static_cast<uint8_t>(heaps[0].GetMinimum().body_[0]);
+            heaps[0].ExtractMinimum();
+        }
+    }));
+    PrintResult("PayloadHeap<int, Request>", "fill+meld+drain", MeasureMilliseconds([&] {
+        auto slab = std::make_shared<heaps::PayloadSlab<Request>>();
+        std::vector<heaps::PayloadHeap<int, Request>> heaps;
+        for (size_t i = 0; i < kHeapsCnt; ++i) {
+            heaps.emplace_back(slab);
+        }
+        for (size_t i = 0; i < keys.size(); ++i) {
+            Request request{keys[i], {}};
+            request.body_[0] = static_cast<char>(i);
+            heaps[i % kHeapsCnt].Push(keys[i], request);
+        }
+        for (size_t i = 1; i < kHeapsCnt; ++i) {
+            heaps[0].Merge(heaps[i]);
+        }
+        while (!heaps[0].Empty()) {
+            benchmark_sink += static_cast<uint8_t>(heaps[0].PopMin().second.body_[0]);
+        }
+    }));
+}
+
+// Best 1024 keys of a stream: inserting everything and trimming at the end against the bounded heap.
+// The stream is split between 64 heaps, which are merged at the end.
+void TopKSuite(const BenchmarkConfig &config) {
+    auto keys = RandomKeys(config.keys_cnt_, config.seed_);
+    constexpr size_t kHeapsCnt = 64;
+    constexpr size_t kBest = 1024;
+    PrintSuite("Top " + std::to_string(kBest) + " of a stream");
+    PrintResult("LeftistHeap", "insert+trim", MeasureMilliseconds([&] {
+        std::vector<heaps::LeftistHeap<int>> heaps(kHeapsCnt);
+        for (size_t i = 0; i < keys.size(); ++i) {
+            heaps[i % kHeapsCnt].Insert(keys[i]);
+        }
+        for (size_t i = 1; i < kHeapsCnt; ++i) {
+            heaps[0].Merge(heaps[i]);
+        }
+        while (heaps[0].Size() > kBest) {
+            heaps[0].ExtractMinimum();
+        }
+        benchmark_sink += static_cast<uint32_t>(heaps[0].GetMinimum());
+    }));
+    size_t peak_bytes = 0;
+    PrintResult("BoundedHeap<LeftistHeap>", "offer+merge", MeasureMilliseconds([&] {
+        std::vector<heaps::BoundedHeap<int>> heaps(kHeapsCnt, heaps::BoundedHeap<int>(kBest));
+        for (size_t i = 0; i < keys.size(); ++i) {
+            heaps[i % kHeapsCnt].Offer(keys[i]);
+        }
+        for (auto &heap: heaps) {
+            peak_bytes += heap.ByteUsage();
+        }
+        for (size_t i = 1; i < kHeapsCnt; ++i) {
+            heaps[0].Merge(heaps[i]);
+        }
+        benchmark_sink += static_cast<uint32_t>(heaps[0].Boundary());
+    }));
+    std::printf("%-28s peak %zu KiB, unbounded %zu KiB\n", "", peak_bytes / 1024,
+                keys.size() * heaps::LeftistHeap<int>::kNodeBytes / 1024);
+}
+
+// Rank-biased leftist heap with the recursive merge against the weight-biased one with the single-pass merge,
+// and the heaps without ranks: the skew heap and the randomized one.
+void LeftistVariantsSuite(const BenchmarkConfig &config) {
+    auto keys = RandomKeys(config.keys_cnt_, config.seed_);
+    PrintSuite("Leftist heap variants");
+    RunStandardWorkloads<heaps::LeftistHeap<int>>("LeftistHeap", keys);
+    RunStandardWorkloads<heaps::WeightBiasedLeftistHeap<int>>("WeightBiasedLeftistHeap", keys);
+    RunStandardWorkloads<heaps::SkewHeap<int>>("SkewHeap", keys);
+    RunStandardWorkloads<heaps::RandomizedMeldableHeap<int>>("RandomizedMeldableHeap", keys);
+}
+
+// Latencies of the single operations of a scheduler queue, prefilled with a half of the keys:
+// insertions, extractions and every 1024 operations a meld with a batch of 256 new keys.
+// Timestamps grow with jitter.
+template<class Heap>
+void RunSchedulerLatencies(const std::string &name, const std::vector<int> &keys) {
+    Heap heap;
+    std::vector<uint64_t> samples;
+    samples.reserve(keys.size());
+    auto timestamp = [&keys](size_t i) {
+        return static_cast<int>(i) + (keys[i] & 1023);
+    };
+    size_t next = 0;
+    for (; next < keys.size() / 2; ++next) {
+        heap.Insert(timestamp(next));
+    }
+    for (size_t i = 0; next < keys.size(); ++i) {
+        if (i % 1024 == 1023 && next + 256 <= keys.size()) {
+            Heap batch;
+            for (size_t j = 0; j < 256; ++j, ++next) {
+                batch.Insert(timestamp(next));
+            }
+            samples.push_back(MeasureNanoseconds([&] {
+                heap.Merge(batch);
+            }));
+        } else if (i % 2 == 0 || heap.Empty()) {
+            const int key = timestamp(next++);
+            samples.push_back(MeasureNanoseconds([&] {
+                heap.Insert(key);
+            }));
+        } else {
+            samples.push_back(MeasureNanoseconds([&] {
+                benchmark_sink += static_cast<uint32_t>(heap.GetMinimum());
+                heap.ExtractMinimum();
+            }));
+        }
+    }
+    PrintLatencies(name, "scheduler", samples);
+}
+
+// Tail latencies of the single operations. Amortized heaps may have long operations,
+// the deamortized skew heap bounds the merge steps per operation.
+void LatencySuite(const BenchmarkConfig &config) {
+    auto keys = RandomKeys(config.keys_cnt_, config.seed_);
+    PrintLatencySuite("Per-operation latency");
+    RunSchedulerLatencies<heaps::LeftistHeap<int>>("LeftistHeap", keys);
+    RunSchedulerLatencies<heaps::WeightBiasedLeftistHeap<int>>("WeightBiasedLeftistHeap", keys);
+    RunSchedulerLatencies<heaps::SkewHeap<int>>("SkewHeap", keys);
+    RunSchedulerLatencies<heaps::DeamortizedSkewHeap<int>>("DeamortizedSkewHeap<64>", keys);
+    RunSchedulerLatencies<heaps::DeamortizedSkewHeap<int, 32>>("DeamortizedSkewHeap<32>", keys);
+    RunSchedulerLatencies<heaps::RandomizedMeldableHeap<int>>("RandomizedMeldableHeap", keys);
+    RunSchedulerLatencies<heaps::BinomialHeap<int>>("BinomialHeap", keys);
+    RunSchedulerLatencies<heaps::LazyBinomialHeap<int>>("LazyBinomialHeap", keys);
+    RunSchedulerLatencies<heaps::SkewBinomialHeap<int>>("SkewBinomialHeap", keys);
+}
+
+// Composite key of a multi-tenant scheduler, ordered lexicographically.
+struct TenantTask {
+    uint16_t tenant_;
+    uint16_t priority_;
+    double deadline_;
+    uint64_t sequence_;
+
+    bool operator<(const TenantTask &other) const {
+        return std::tie(tenant_, priority_, deadline_, sequence_) <
+               std::tie(other.tenant_, other.priority_, other.deadline_, other.sequence_);
+    }
+};
+
+template<>
+struct heaps::KeyNormalizer<TenantTask> {
+    using Tuple = std::tuple<const uint16_t &, const uint16_t &, const double &, const uint64_t &>;
+    static constexpr size_t kBits = KeyNormalizer<Tuple>::kBits;
+    static constexpr bool kExact = KeyNormalizer<Tuple>::kExact;
+
+    static uint64_t Prefix(const TenantTask &task) {
+        return KeyNormalizer<Tuple>::Prefix(std::tie(task.tenant_, task.priority_, task.deadline_, task.sequence_));
+    }
+};
+
+template<class Heap, class Key>
+void RunInsertDrain(const std::string &name, const std::vector<Key> &keys) {
+    PrintResult(name, "insert+drain", MeasureMilliseconds([&] {
+        Heap heap;
+        for (const auto &key: keys) {
+            heap.Insert(key);
+        }
+        while (!heap.Empty()) {
+            benchmark_sink += heap.Size();
+            heap.ExtractMinimum();
+        }
+    }));
+}
+
+// Composite and string keys compared in full against the ones with the normalized prefixes.
+void NormalizedKeysSuite(const BenchmarkConfig &config) {
+    auto keys = RandomKeys(config.keys_cnt_, config.seed_);
+    std::vector<TenantTask> tasks(keys.size());
+    std::vector<std::string> texts(keys.size() / 4);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        const auto key = static_cast<uint32_t>(keys[i]);
+        tasks[i] = TenantTask{static_cast<uint16_t>(key % 8), static_cast<uint16_t>(key / 8 % 4),
+                              static_cast<double>(key % 100'000) / 8, i};
+        if (i < texts.size()) {
+            texts[i] = "tenant-" + std::to_string(key % 16) + "/job-" + std::to_string(key);
+        }
+    }
+    PrintSuite("Normalized key prefixes");
+    RunInsertDrain<heaps::LeftistHeap<TenantTask>>("LeftistHeap<Task>", tasks);
+    RunInsertDrain<heaps::LeftistHeap<heaps::NormalizedKey<TenantTask>>>("LeftistHeap<Normalized>", tasks);
+    RunInsertDrain<heaps::BinomialHeap<TenantTask>>("BinomialHeap<Task>", tasks);
+    RunInsertDrain<heaps::BinomialHeap<heaps::NormalizedKey<TenantTask>>>("BinomialHeap<Normalized>", tasks);
+    RunInsertDrain<heaps::LeftistHeap<std::string>>("LeftistHeap<string>", texts);
+    RunInsertDrain<heaps::LeftistHeap<heaps::NormalizedKey<std::string>>>("LeftistHeap<Normalized>", texts);
+}
+
+// Two producers push the keys in batches of batch_size, then two consumers drain the channel.
+template<template<class> class Heap>
+void RunChannelThroughput(const std::string &name, const std::vector<int> &keys, size_t batch_size) {
+    heaps::PriorityChannel<int, Heap> channel;
+    auto run_threads = [](auto &&body) {
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < 2; ++i) {
+            threads.emplace_back(body, i);
+        }
+        for (auto &thread: threads) {
+            thread.join();
+        }
+    };
+    PrintResult(name, "push x" + std::to_string(batch_size), MeasureMilliseconds([&] {
+        run_threads([&channel, &keys, batch_size](size_t producer) {
+            std::vector<int> batch;
+            for (size_t j = producer; j < keys.size(); j += 2) {
+                batch.push_back(keys[j]);
+                if (batch.size() == batch_size) {
+                    channel.PushBatch(batch);
+                    batch.clear();
+                }
+            }
+            channel.PushBatch(batch);
+        });
+    }));
+    channel.Close();
+    PrintResult(name, "pop", MeasureMilliseconds([&] {
+        run_threads([&channel](size_t) {
+            while (auto key = channel.Pop()) {
+                benchmark_sink += static_cast<uint64_t>(*key);
+            }
+        });
+    }));
+}
+
+uint64_t NowNanoseconds() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// A consumer thread waits in Pop, the producer pushes its timestamp as the key.
+void RunThreadWakeLatency(size_t rounds) {
+    heaps::PriorityChannel<uint64_t> channel;
+    std::vector<uint64_t> samples;
+    samples.reserve(rounds);
+    std::thread consumer([&] {
+        while (auto pushed = channel.Pop()) {
+            samples.push_back(NowNanoseconds() - *pushed);
+        }
+    });
+    for (size_t i = 0; i < rounds; ++i) {
+        while (channel.WaitersCount() == 0) {
+            std::this_thread::yield();
+        }
+        channel.Push(NowNanoseconds());
+    }
+    while (channel.WaitersCount() == 0) {
+        std::this_thread::yield();
+    }
+    channel.Close();
+    consumer.join();
+    PrintLatencies("PriorityChannel", "thread wake-up", samples);
+}
+
+#ifdef MERGEABLE_HEAPS_HAS_COROUTINES
+// Coroutine, which is destroyed at the end.
+struct DetachedCoroutine {
+    struct promise_type {
+        DetachedCoroutine get_return_object() {
+            return {};
+        }
+
+        std::suspend_never initial_suspend() noexcept {
+            return {};
+        }
+
+        std::suspend_never final_suspend() noexcept {
+            return {};
+        }
+
+        void return_void() {}
+
+        void unhandled_exception() {
+            std::terminate();
+        }
+    };
+};
+
+DetachedCoroutine ConsumeTimestamps(heaps::PriorityChannel<uint64_t> &channel, std::vector<uint64_t> &samples) {
+    while (auto pushed = co_await channel.AsyncPop()) {
+        samples.push_back(NowNanoseconds() - *pushed);
+    }
+}
+
+// A suspended consumer coroutine is resumed by the pushing thread.
+void RunCoroutineWakeLatency(size_t rounds) {
+    heaps::PriorityChannel<uint64_t> channel;
+    std::vector<uint64_t> samples;
+    samples.reserve(rounds);
+    ConsumeTimestamps(channel, samples);
+    for (size_t i = 0; i < rounds; ++i) {
+        channel.Push(NowNanoseconds());
+    }
+    channel.Close();
+    PrintLatencies("PriorityChannel", "coroutine wake-up", samples);
+}
+#endif
+
+// Batches melded outside of the lock against the pushes one by one, and the latency of waking a consumer.
+void ChannelSuite(const BenchmarkConfig &config) {
+    auto keys = RandomKeys(config.keys_cnt_, config.seed_);
+    PrintSuite("Priority channel, 2 producers, then 2 consumers");
+    for (size_t batch_size: {size_t(1), size_t(64)}) {
+        RunChannelThroughput<heaps::LeftistHeap>("PriorityChannel<LeftistHeap>", keys, batch_size);
+        RunChannelThroughput<heaps::BinomialHeap>("PriorityChannel<BinomialHeap>", keys, batch_size);
+        RunChannelThroughput<heaps::StlHeap>("PriorityChannel<StlHeap>", keys, batch_size);
+    }
+    const size_t rounds = std::min<size_t>(config.keys_cnt_, 20'000);
+    PrintLatencySuite("Priority channel wake-up latency");
+    RunThreadWakeLatency(rounds);
+#ifdef MERGEABLE_HEAPS_HAS_COROUTINES
+    RunCoroutineWakeLatency(rounds);
+#endif
+}
+
+// Forked processes insert their share of the keys into one shared heap, extracting a key after every second insert.
+template<template<class> class Heap>
+void RunSharedMemoryProcesses(const std::string &name, const std::vector<int> &keys, size_t processes_cnt) {
+    using SharedHeap = heaps::SharedMemoryHeap<int, Heap>;
+    const std::string segment = "/mergeable_heaps_benchmark_" + std::to_string(getpid());
+    auto heap = SharedHeap::Create(segment, keys.size());
+    PrintResult(name, std::to_string(processes_cnt) + " processes", MeasureMilliseconds([&] {
+        std::vector<pid_t> children;
+        for (size_t process = 0; process < processes_cnt; ++process) {
+            const pid_t pid = fork();
+            if (pid == 0) {
+                auto shared = SharedHeap::Open(segment);
+                for (size_t i = process; i < keys.size(); i += processes_cnt) {
+                    shared.Insert(keys[i]);
+                    if (i / processes_cnt % 2 == 1) {
+                        shared.TakeMinimum();
+                    }
+                }
+                _exit(0);
+            }
+            children.push_back(pid);
+        }
+        for (pid_t pid: children) {
+            waitpid(pid, nullptr, 0);
+        }
+    }));
+    benchmark_sink += heap.Size();
+    SharedHeap::Unlink(segment);
+}
+
+// One queue shared by the worker processes through a shared memory segment
+void SharedMemorySuite(const BenchmarkConfig &config) {
+    auto keys = RandomKeys(config.keys_cnt_, config.seed_);
+    PrintSuite("Shared memory heap");
+    PrintResult("LeftistHeap", "in process", MeasureMilliseconds([&] {
+        heaps::LeftistHeap<int> heap;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            heap.Insert(keys[i]);
+            if (i % 2 == 1) {
+                heap.ExtractMinimum();
+            }
+        }
+        benchmark_sink += heap.Size();
+    }));
+    for (size_t processes_cnt: {size_t(1), size_t(4)}) {
+        RunSharedMemoryProcesses<heaps::LeftistHeap>("SharedMemoryHeap<Leftist>", keys, processes_cnt);
+        RunSharedMemoryProcesses<heaps::SkewHeap>("SharedMemoryHeap<Skew>", keys, processes_cnt);
+    }
+}
+
+// Bursts of inserts, each followed by a few reads of the minimum and one extraction.
+template<class Heap>
+void RunIngestBursts(const std::string &name, const std::vector<int> &keys, size_t burst) {
+    PrintResult(name, "bursts of " + std::to_string(burst), MeasureMilliseconds([&] {
+        Heap heap;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            heap.Insert(keys[i]);
+            if (i % burst == burst - 1) {
+                benchmark_sink += static_cast<uint64_t>(heap.GetMinimum());
+                heap.ExtractMinimum();
+            }
+        }
+        benchmark_sink += heap.Size();
+    }));
+}
+
+// Inserts melded one by one against the ones buffered until the next extraction.
+void InsertBufferSuite(const BenchmarkConfig &config) {
+    auto keys = RandomKeys(config.keys_cnt_, config.seed_);
+    PrintSuite("Insert buffer");
+    for (size_t burst: {size_t(16), size_t(4096)}) {
+        RunIngestBursts<heaps::LeftistHeap<int>>("LeftistHeap", keys, burst);
+        RunIngestBursts<heaps::LeftistHeap<int, 0, true>>("LeftistHeap<buffered>", keys, burst);
+        RunIngestBursts<heaps::SkewHeap<int>>("SkewHeap", keys, burst);
+        RunIngestBursts<heaps::SkewHeap<int, 0, true>>("SkewHeap<buffered>", keys, burst);
+        RunIngestBursts<heaps::BinomialHeap<int>>("BinomialHeap", keys, burst);
+        RunIngestBursts<heaps::BinomialHeap<int, 0, true>>("BinomialHeap<buffered>", keys, burst);
+    }
+}
+
+// Sorted output of a whole heap: ExtractMinimum one by one against DrainSorted. The heap is built untimed.
+template<class Heap>
+void RunDrain(const std::string &name, const std::vector<int> &keys, size_t threads_cnt) {
+    Heap heap;
+    for (int key: keys) {
+        heap.Insert(key);
+    }
+    std::vector<int> sorted(keys.size());
+    const std::string workload = threads_cnt == 0 ? "ExtractMinimum" : "DrainSorted x" + std::to_string(threads_cnt);
+    PrintResult(name, workload, MeasureMilliseconds([&] {
+        if (threads_cnt == 0) {
+            for (auto &key: sorted) {
+                key = heap.GetMinimum();
+                heap.ExtractMinimum();
+            }
+        } else {
+            heap.DrainSorted(sorted.begin(), threads_cnt);
+        }
+    }));
+    benchmark_sink += static_cast<uint64_t>(sorted[sorted.size() / 2]);
+}
+
+// Draining a large heap into a sorted output
+void DrainSuite(const BenchmarkConfig &config) {
+    auto keys = RandomKeys(config.keys_cnt_, config.seed_);
+    PrintSuite("Sorted drain");
+    for (size_t threads_cnt: {size_t(0), size_t(1), size_t(4)}) {
+        RunDrain<heaps::LeftistHeap<int>>("LeftistHeap", keys, threads_cnt);
+        RunDrain<heaps::SkewHeap<int>>("SkewHeap", keys, threads_cnt);
+        RunDrain<heaps::BinomialHeap<int>>("BinomialHeap", keys, threads_cnt);
+    }
+}
+
+// Latency of every insert into a growing heap
+template<class Heap>
+void RunInsertLatencies(const std::string &name, const std::vector<int> &keys) {
+    std::vector<uint64_t> samples;
+    samples.reserve(keys.size());
+    Heap heap;
+    for (int key: keys) {
+        samples.push_back(MeasureNanoseconds([&] {
+            heap.Insert(key);
+        }));
+    }
+    benchmark_sink += heap.Size();
+    PrintLatencies(name, "insert", samples);
+}
+
+// Binomial heap against the skew binomial one, which inserts without carries.
+void SkewBinomialSuite(const BenchmarkConfig &config) {
+    auto keys = RandomKeys(config.keys_cnt_, config.seed_);
+    PrintSuite("Skew binomial heap");
+    RunStandardWorkloads<heaps::BinomialHeap<int>>("BinomialHeap", keys);
+    RunStandardWorkloads<heaps::SkewBinomialHeap<int>>("SkewBinomialHeap", keys);
+    PrintLatencySuite("Insert latency");
+    RunInsertLatencies<heaps::BinomialHeap<int>>("BinomialHeap", keys);
+    RunInsertLatencies<heaps::SkewBinomialHeap<int>>("SkewBinomialHeap", keys);
+    RunInsertLatencies<heaps::LazyBinomialHeap<int>>("LazyBinomialHeap", keys);
+}
+
+// Arithmetic key opted in for the branchless merges. Same layout as T.
+template<class T>
+struct CmovKey {
+    T value_;
+
+    CmovKey(T value = T()) : value_(value) {}
+
+    bool operator<(const CmovKey &other) const {
+        return value_ < other.value_;
+    }
+
+    CmovKey operator+(const CmovKey &other) const {
+        return CmovKey(value_ + other.value_);
+    }
+
+    explicit operator uint64_t() const {
+        return static_cast<uint64_t>(value_);
+    }
+};
+
+template<class T>
+struct heaps::BranchlessKey<CmovKey<T>> : std::true_type {};
+
+// Runs the merge-heavy workloads, counting the branch misses.
+template<class Heap, class Key>
+void RunBranchWorkloads(const std::string &name, const std::vector<Key> &keys) {
+    auto run = [&](const std::string &workload, auto &&f) {
+        double milliseconds = 0;
+        const int64_t misses = CountBranchMisses([&] {
+            milliseconds = MeasureMilliseconds([&] {
+                benchmark_sink += f();
+            });
+        });
+        PrintBranchResult(name, workload, milliseconds, misses);
+    };
+    run("insert+drain", [&] { return InsertThenDrain<Heap>(keys); });
+    run("mixed", [&] { return MixedOperations<Heap>(keys); });
+    run("meld pairwise", [&] { return MeldPairwise<Heap>(keys); });
+}
+
+// Root choice of the merges with conditional moves against the branches, the keys are the same.
+void BranchlessSuite(const BenchmarkConfig &config) {
+    auto keys = RandomKeys(config.keys_cnt_, config.seed_);
+    std::vector<uint64_t> wide_keys;
+    std::vector<double> real_keys;
+    for (int key: keys) {
+        wide_keys.push_back(static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ULL);
+        real_keys.push_back(static_cast<double>(key) / 3);
+    }
+    std::vector<CmovKey<int>> cmov_keys(keys.begin(), keys.end());
+    std::vector<CmovKey<uint64_t>> cmov_wide_keys(wide_keys.begin(), wide_keys.end());
+    std::vector<CmovKey<double>> cmov_real_keys(real_keys.begin(), real_keys.end());
+    PrintBranchSuite("Branchless merges");
+    RunBranchWorkloads<heaps::LeftistHeap<int>>("LeftistHeap<int>", keys);
+    RunBranchWorkloads<heaps::LeftistHeap<CmovKey<int>>>("LeftistHeap<cmov int>", cmov_keys);
+    RunBranchWorkloads<heaps::LeftistHeap<uint64_t>>("LeftistHeap<uint64_t>", wide_keys);
+    RunBranchWorkloads<heaps::LeftistHeap<CmovKey<uint64_t>>>("LeftistHeap<cmov uint64_t>", cmov_wide_keys);
+    RunBranchWorkloads<heaps::LeftistHeap<double>>("LeftistHeap<double>", real_keys);
+    RunBranchWorkloads<heaps::LeftistHeap<CmovKey<double>>>("LeftistHeap<cmov double>", cmov_real_keys);
+    RunBranchWorkloads<heaps::SkewHeap<int>>("SkewHeap<int>", keys);
+    RunBranchWorkloads<heaps::SkewHeap<CmovKey<int>>>("SkewHeap<cmov int>", cmov_keys);
+    RunBranchWorkloads<heaps::SkewHeap<uint64_t>>("SkewHeap<uint64_t>", wide_keys);
+    RunBranchWorkloads<heaps::SkewHeap<CmovKey<uint64_t>>>("SkewHeap<cmov uint64_t>", cmov_wide_keys);
+    RunBranchWorkloads<heaps::SkewHeap<double>>("SkewHeap<double>", real_keys);
+    RunBranchWorkloads<heaps::SkewHeap<CmovKey<double>>>("SkewHeap<cmov double>", cmov_real_keys);
+    // In cache the mispredictions matter more than the latency of the loads.
+    std::vector<int> small_keys(keys.begin(), keys.begin() + std::min<size_t>(keys.size(), 1 << 14));
+    std::vector<CmovKey<int>> cmov_small_keys(small_keys.begin(), small_keys.end());
+    RunBranchWorkloads<heaps::LeftistHeap<int>>("LeftistHeap<int>, 16K", small_keys);
+    RunBranchWorkloads<heaps::LeftistHeap<CmovKey<int>>>("LeftistHeap<cmov int>, 16K", cmov_small_keys);
+    RunBranchWorkloads<heaps::SkewHeap<int>>("SkewHeap<int>, 16K", small_keys);
+    RunBranchWorkloads<heaps::SkewHeap<CmovKey<int>>>("SkewHeap<cmov int>, 16K", cmov_small_keys);
+}
+
+// Runs all the suites. Optional arguments are the number of keys and the number of edges.
+int RunBenchmarks(int argc, char *argv[]) {
+    BenchmarkConfig config;
+    if (argc > 1) {
+        config.keys_cnt_ = std::strtoull(argv[1], nullptr, 10);
+    }
+    if (argc > 2) {
+        config.edges_cnt_ = std::strtoull(argv[2], nullptr, 10);
+    }
+    BinomialRootsSuite(config);
+    BlockedNodesSuite(config);
+    InlineBufferSuite(config);
+    MonotonePrioritiesSuite(config);
+    SelectionSuite(config);
+    GraphAlgorithmsSuite(config);
+    WorkStealingSuite(config);
+    TimersSuite(config);
+    DoubleEndedSuite(config);
+    TombstonesSuite(config);
+    ConversionSuite(config);
+    PayloadSuite(config);
+    TopKSuite(config);
+    LeftistVariantsSuite(config);
+    LatencySuite(config);
+    NormalizedKeysSuite(config);
+    ChannelSuite(config);
+    SharedMemorySuite(config);
+    InsertBufferSuite(config);
+    DrainSuite(config);
+    SkewBinomialSuite(config);
+    BranchlessSuite(config);
+    std::printf("\nchecksum: %llu\n", static_cast<unsigned long long>(benchmark_sink));
+    return 0;
+}
@@ -0,0 +1,49 @@
+#ifndef MERGEABLE_HEAPS_GRAPHS_H
+#define MERGEABLE_HEAPS_GRAPHS_H
+
+#include <cmath>
+#include <random>
+#include <vector>
+#include "mergeable_heaps/algorithms/graph.h"
+
+// Sparse random graph with the average degree 8, weights are uniform in [1, 10^6].
+// Vertex i - 1 is connected to i, so every vertex is reachable from 0.
+inline std::vector<heaps::Edge<int64_t>> RandomGraph(size_t edges_cnt, uint32_t seed, size_t &vertices_cnt) {
+    std::mt19937 gen(seed);
+    vertices_cnt = std::max<size_t>(edges_cnt / 8, 2);
+    std::vector<heaps::Edge<int64_t>> edges;
+    edges.reserve(edges_cnt + vertices_cnt);
+    for (uint32_t v = 1; v < vertices_cnt; ++v) {
+        edges.push_back({v - 1, v, static_cast<int64_t>(1 + gen() % 1'000'000)});
+    }
+    while (edges.size() < edges_cnt) {
+        edges.push_back({static_cast<uint32_t>(gen() % vertices_cnt), static_cast<uint32_t>(gen() % vertices_cnt),
+                         static_cast<int64_t>(1 + gen() % 1'000'000)});
+    }
+    return edges;
+}
+
+// Square grid with the edges to 4 neighbours, like a road network: long shortest paths, small degrees.
+inline std::vector<heaps::Edge<int64_t>> GridGraph(size_t edges_cnt, uint32_t seed, size_t &vertices_cnt) {
+    std::mt19937 gen(seed);
+    auto side = static_cast<uint32_t>(std::max(2.0, std::sqrt(static_cast<double>(edges_cnt) / 4)));
+    vertices_cnt = static_cast<size_t>(side) * side;
+    std::vector<heaps::Edge<int64_t>> edges;
+    edges.reserve(4 * vertices_cnt);
+    for (uint32_t x = 0; x < side; ++x) {
+        for (uint32_t y = 0; y < side; ++y) {
+            uint32_t v = x * side + y;
+            if (x + 1 < side) {
+                edges.push_back({v, v + side, static_cast<int64_t>(1 + gen() % 1000)});
+                edges.push_back({v + side, v, static_cast<int64_t>(1 + gen() % 1000)});
+            }
+            if (y + 1 < side) {
+                edges.push_back({v, v + 1, static_cast<int64_t>(1 + gen() % 1000)});
+                edges.push_back({v + 1, v, static_cast<int64_t>(1 + gen() % 1000)});
+            }
+        }
+    }
+    return edges;
+}
+
+#endif // MERGEABLE_HEAPS_GRAPHS_H
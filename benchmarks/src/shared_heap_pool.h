@@ -0,0 +1,93 @@
+#ifndef MERGEABLE_HEAPS_SHARED_HEAP_POOL_H
+#define MERGEABLE_HEAPS_SHARED_HEAP_POOL_H
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "mergeable_heaps/leftist_heap.h"
+
+// Baseline for the work-stealing scheduler: all the workers share one heap under one lock.
+// Has the same Submit/Wait interface as heaps::WorkStealingScheduler.
+class SharedHeapPool {
+public:
+    using Task = std::function<void()>;
+
+    explicit SharedHeapPool(size_t workers_cnt) {
+        for (size_t i = 0; i < std::max<size_t>(workers_cnt, 1); ++i) {
+            threads_.emplace_back([this] { Run(); });
+        }
+    }
+
+    ~SharedHeapPool() {
+        Wait();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        not_empty_.notify_all();
+        for (auto &thread: threads_) {
+            thread.join();
+        }
+    }
+
+    void Submit(int64_t priority, Task task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++pending_;
+            queue_.Insert(Entry{priority, sequence_++, new Task(std::move(task))});
+        }
+        not_empty_.notify_one();
+    }
+
+    void Wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return pending_ == 0; });
+    }
+
+private:
+    struct Entry {
+        int64_t priority_;
+        uint64_t sequence_;
+        Task *task_;
+
+        bool operator<(const Entry &other) const {
+            return priority_ < other.priority_ || (priority_ == other.priority_ && sequence_ < other.sequence_);
+        }
+    };
+
+    void Run() {
+        while (true) {
+            Entry entry{};
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                not_empty_.wait(lock, [this] { return stopping_ || !queue_.Empty(); });
+                if (queue_.Empty()) {
+                    return;
+                }
+                entry = queue_.GetMinimum();
+                queue_.ExtractMinimum();
+            }
+            (*entry.task_)();
+            delete entry.task_;
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--pending_ == 0) {
+                done_.notify_all();
+            }
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable done_;
+    heaps::LeftistHeap<Entry> queue_;
+    uint64_t sequence_ = 0;
+    size_t pending_ = 0;
+    bool stopping_ = false;
+    std::vector<std::thread> threads_;
+};
+
+#endif // MERGEABLE_HEAPS_SHARED_HEAP_POOL_H
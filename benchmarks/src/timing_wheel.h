@@ -0,0 +1,124 @@
+#ifndef MERGEABLE_HEAPS_TIMING_WHEEL_H
+#define MERGEABLE_HEAPS_TIMING_WHEEL_H
+
+#include <cstdint>
+#include <vector>
+
+// Baseline for heaps::TimerQueue: hashed timing wheel with one slot per tick.
+// A timer is kept in the slot deadline % kSlotsCnt in an intrusive doubly linked list,
+// so Schedule and Cancel are O(1). ExpireUntil visits every slot between the ticks and
+// skips the timers, which are kSlotsCnt or more ticks ahead. Has the same interface as heaps::TimerQueue.
+template<class Payload>
+class HashedTimingWheel {
+public:
+    struct Handle {
+        uint32_t node_ = kNone;
+        uint32_t generation_ = 0;
+    };
+
+    Handle Schedule(uint64_t deadline, Payload payload) {
+        uint32_t index;
+        if (free_ != kNone) {
+            index = free_;
+            free_ = nodes_[index].next_;
+        } else {
+            index = static_cast<uint32_t>(nodes_.size());
+            nodes_.emplace_back();
+        }
+        Node &node = nodes_[index];
+        node.deadline_ = deadline < now_ ? now_ : deadline;
+        node.payload_ = payload;
+        Link(index, static_cast<uint32_t>(node.deadline_ % kSlotsCnt));
+        ++size_;
+        return Handle{index, node.generation_};
+    }
+
+    bool Cancel(const Handle &handle) {
+        if (handle.node_ == kNone || nodes_[handle.node_].generation_ != handle.generation_) {
+            return false;
+        }
+        Unlink(handle.node_);
+        Free(handle.node_);
+        --size_;
+        return true;
+    }
+
+    template<class Callback>
+    size_t ExpireUntil(uint64_t now, Callback &&callback) {
+        size_t fired = 0;
+        // After a full turn every slot is visited, the rest of the ticks change nothing.
+        const uint64_t last = now - now_ >= kSlotsCnt ? now_ + kSlotsCnt - 1 : now;
+        for (uint64_t tick = now_; tick <= last; ++tick) {
+            const auto slot = static_cast<uint32_t>(tick % kSlotsCnt);
+            uint32_t index = heads_[slot];
+            while (index != kNone) {
+                const uint32_t next = nodes_[index].next_;
+                if (nodes_[index].deadline_ <= now) {
+                    Unlink(index);
+                    Payload payload = nodes_[index].payload_;
+                    Free(index);
+                    --size_;
+                    ++fired;
+                    callback(payload);
+                }
+                index = next;
+            }
+        }
+        now_ = now;
+        return fired;
+    }
+
+    size_t Size() const {
+        return size_;
+    }
+
+private:
+    static constexpr uint32_t kSlotsCnt = 4096;
+    static constexpr uint32_t kNone = static_cast<uint32_t>(-1);
+
+    struct Node {
+        uint64_t deadline_ = 0;
+        Payload payload_{};
+        uint32_t prev_ = kNone;
+        uint32_t next_ = kNone;
+        uint32_t slot_ = kNone;
+        uint32_t generation_ = 0;
+    };
+
+    void Link(uint32_t index, uint32_t slot) {
+        Node &node = nodes_[index];
+        node.slot_ = slot;
+        node.prev_ = kNone;
+        node.next_ = heads_[slot];
+        if (heads_[slot] != kNone) {
+            nodes_[heads_[slot]].prev_ = index;
+        }
+        heads_[slot] = index;
+    }
+
+    void Unlink(uint32_t index) {
+        Node &node = nodes_[index];
+        if (node.prev_ != kNone) {
+            nodes_[node.prev_].next_ = node.next_;
+        } else {
+            heads_[node.slot_] = node.next_;
+        }
+        if (node.next_ != kNone) {
+            nodes_[node.next_].prev_ = node.prev_;
+        }
+    }
+
+    void Free(uint32_t index) {
+        ++nodes_[index].generation_;
+        nodes_[index].next_ = free_;
+        free_ = index;
+    }
+
+    std::vector<uint32_t> heads_ = std::vector<uint32_t>(kSlotsCnt, kNone);
+    std::vector<Node> nodes_;
+    uint32_t free_ = kNone;
+    uint64_t now_ = 0;
+    size_t size_ = 0;
+};
+
+#endif // MERGEABLE_HEAPS_TIMING_WHEEL_H
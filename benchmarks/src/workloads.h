@@ -0,0 +1,146 @@
+#ifndef MERGEABLE_HEAPS_WORKLOADS_H
+#define MERGEABLE_HEAPS_WORKLOADS_H
+
+#include <random>
+#include <string>
+#include <vector>
+#include "benchmark.h"
+
+// Inserts all the keys, the heap is dropped afterwards.
+template<class Heap, class Key>
+uint64_t InsertOnly(const std::vector<Key> &keys) {
+    Heap heap;
+    for (const auto &key: keys) {
+        heap.Insert(key);
+    }
+    return static_cast<uint64_t>(heap.GetMinimum());
+}
+
+// Inserts all the keys and then extracts them one by one.
+template<class Heap, class Key>
+uint64_t InsertThenDrain(const std::vector<Key> &keys) {
+    Heap heap;
+    for (const auto &key: keys) {
+        heap.Insert(key);
+    }
+    uint64_t checksum = 0;
+    while (!heap.Empty()) {
+        checksum += static_cast<uint64_t>(heap.GetMinimum());
+        heap.ExtractMinimum();
+    }
+    return checksum;
+}
+
+// Interleaves insertions with the queries of the minimum and extractions,
+// the heap stays about half of the keys large.
+template<class Heap, class Key>
+uint64_t MixedOperations(const std::vector<Key> &keys) {
+    Heap heap;
+    uint64_t checksum = 0;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        heap.Insert(keys[i]);
+        checksum += static_cast<uint64_t>(heap.GetMinimum());
+        if (i % 2 == 1) {
+            heap.ExtractMinimum();
+        }
+    }
+    return checksum;
+}
+
+// Creates one-item heaps and melds them pairwise until one heap is left.
+template<class Heap, class Key>
+uint64_t MeldPairwise(const std::vector<Key> &keys) {
+    std::vector<Heap> heaps;
+    heaps.reserve(keys.size());
+    for (const auto &key: keys) {
+        heaps.emplace_back(key);
+    }
+    for (size_t step = 1; step < heaps.size(); step *= 2) {
+        for (size_t i = 0; i + step < heaps.size(); i += 2 * step) {
+            heaps[i].Merge(heaps[i + step]);
+        }
+    }
+    return heaps.empty() ? 0 : static_cast<uint64_t>(heaps[0].GetMinimum());
+}
+
+// Many small per-entity queues: every heap gets a few keys, melds with its neighbour
+// and is drained. Heaps never hold more than 16 keys.
+template<class Heap, class Key>
+uint64_t TinyHeaps(const std::vector<Key> &keys) {
+    static constexpr size_t kKeysPerHeap = 8;
+    std::vector<Heap> heaps(keys.size() / kKeysPerHeap);
+    for (size_t i = 0; i < heaps.size() * kKeysPerHeap; ++i) {
+        heaps[i / kKeysPerHeap].Insert(keys[i]);
+    }
+    uint64_t checksum = 0;
+    for (size_t i = 0; i + 1 < heaps.size(); i += 2) {
+        heaps[i].Merge(heaps[i + 1]);
+        while (!heaps[i].Empty()) {
+            checksum += static_cast<uint64_t>(heaps[i].GetMinimum());
+            heaps[i].ExtractMinimum();
+        }
+    }
+    return checksum;
+}
+
+// Event simulation with non-decreasing priorities: every extracted event schedules
+// up to two new ones at a random delay. Keys are pairs (time, event id).
+template<class Heap, class UInt>
+uint64_t MonotoneEvents(size_t events_cnt, uint32_t seed) {
+    std::mt19937 gen(seed);
+    Heap heap;
+    for (size_t i = 0; i < 1024; ++i) {
+        heap.Insert(std::make_pair(static_cast<UInt>(gen() % 1024), static_cast<UInt>(i)));
+    }
+    uint64_t checksum = 0;
+    for (size_t i = 0; i < events_cnt && !heap.Empty(); ++i) {
+        auto event = heap.GetMinimum();
+        heap.ExtractMinimum();
+        checksum += event.first;
+        for (uint32_t children = gen() % 3; children > 0; --children) {
+            heap.Insert(std::make_pair(static_cast<UInt>(event.first + gen() % 4096), static_cast<UInt>(i)));
+        }
+    }
+    return checksum;
+}
+
+// Idle timeouts of connections: every step some connection gets activity, its timeout is cancelled
+// and scheduled again, so most of the timers are cancelled before firing. Time advances by one tick a step.
+template<class Queue>
+uint64_t CancelHeavyTimers(size_t steps_cnt, uint32_t seed) {
+    constexpr uint32_t kConnectionsCnt = 1024;
+    std::mt19937 gen(seed);
+    Queue queue;
+    std::vector<typename Queue::Handle> timeouts(kConnectionsCnt);
+    uint64_t checksum = 0;
+    for (uint64_t now = 0; now < steps_cnt; ++now) {
+        const uint32_t connection = gen() % kConnectionsCnt;
+        queue.Cancel(timeouts[connection]);
+        timeouts[connection] = queue.Schedule(now + 1000 + gen() % 3000, connection);
+        if (now % 64 == 0) {
+            checksum += queue.ExpireUntil(now, [&](uint32_t expired) {
+                checksum += expired;
+            });
+        }
+    }
+    return checksum + queue.Size();
+}
+
+// Runs the standard set of workloads on the heap and prints the results.
+template<class Heap, class Key>
+void RunStandardWorkloads(const std::string &name, const std::vector<Key> &keys) {
+    PrintResult(name, "insert", MeasureMilliseconds([&] {
+        benchmark_sink += InsertOnly<Heap>(keys);
+    }));
+    PrintResult(name, "insert+drain", MeasureMilliseconds([&] {
+        benchmark_sink += InsertThenDrain<Heap>(keys);
+    }));
+    PrintResult(name, "mixed", MeasureMilliseconds([&] {
+        benchmark_sink += MixedOperations<Heap>(keys);
+    }));
+    PrintResult(name, "meld pairwise", MeasureMilliseconds([&] {
+        benchmark_sink += MeldPairwise<Heap>(keys);
+    }));
+}
+
+#endif // MERGEABLE_HEAPS_WORKLOADS_H
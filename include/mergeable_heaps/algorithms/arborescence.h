@@ -0,0 +1,181 @@
+#ifndef MERGEABLE_HEAPS_ALGORITHMS_ARBORESCENCE_H
+#define MERGEABLE_HEAPS_ALGORITHMS_ARBORESCENCE_H
+
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+#include <type_traits>
+#include "graph.h"
+#include "mergeable_heaps/exceptions.h"
+
+namespace heaps {
+    // Key of the incoming edge in the heaps of Edmonds' algorithm.
+    // Adding a key shifts the weight and keeps the edge, so the heaps with AddToAll may store it.
+    template<class Weight>
+    struct ArborescenceKey {
+        Weight weight_{};
+        uint32_t edge_{};
+
+        bool operator<(const ArborescenceKey &other) const {
+            return weight_ < other.weight_ || (weight_ == other.weight_ && edge_ < other.edge_);
+        }
+
+        ArborescenceKey operator+(const ArborescenceKey &delta) const {
+            return ArborescenceKey{weight_ + delta.weight_, edge_};
+        }
+    };
+
+    namespace detail {
+        template<class Heap, class Key, class = void>
+        struct HasAddToAll : std::false_type {};
+
+        template<class Heap, class Key>
+        struct HasAddToAll<Heap, Key, std::void_t<decltype(std::declval<Heap &>().AddToAll(std::declval<Key>()))>>
+                : std::true_type {};
+
+        // Disjoint set union with path halving and union by size
+        class DisjointSets {
+        public:
+            explicit DisjointSets(size_t n) : parent_(n), size_(n, 1) {
+                std::iota(parent_.begin(), parent_.end(), 0u);
+            }
+
+            uint32_t Find(uint32_t v) {
+                while (parent_[v] != v) {
+                    v = parent_[v] = parent_[parent_[v]];
+                }
+                return v;
+            }
+
+            // Returns false, if the vertices are in the same set already.
+            bool Join(uint32_t a, uint32_t b) {
+                a = Find(a);
+                b = Find(b);
+                if (a == b) {
+                    return false;
+                }
+                if (size_[a] < size_[b]) {
+                    std::swap(a, b);
+                }
+                parent_[b] = a;
+                size_[a] += size_[b];
+                return true;
+            }
+
+        private:
+            std::vector<uint32_t> parent_;
+            std::vector<uint32_t> size_;
+        };
+    } // namespace detail
+
+    // Weight of the minimum spanning arborescence rooted at "root" (Chu-Liu/Edmonds, Tarjan's contraction).
+    // Every vertex keeps a heap of its incoming edges, cycles are contracted by melding the heaps.
+    // Heaps with AddToAll (LeftistHeap, SkewHeap) shift the keys of a whole heap in O(1), O(m log m) in total.
+    // For the other heaps every heap has an offset, heaps with different offsets are melded
+    // by moving the keys of the smaller one, O(m log^2 m) in total.
+    // Throws NoArborescenceException, if some vertex is not reachable from the root.
+    template<template<class> class Heap, class Weight>
+    Weight MinimumArborescence(size_t vertices_cnt, const std::vector<Edge<Weight>> &edges, uint32_t root) {
+        static_assert(std::is_signed_v<Weight>, "Keys are shifted by negative values, Weight must be signed");
+        using Key = ArborescenceKey<Weight>;
+        using HeapType = Heap<Key>;
+        constexpr bool kLazyShift = detail::HasAddToAll<HeapType, Key>::value;
+        constexpr auto kUnseen = static_cast<uint32_t>(-1);
+
+        std::vector<HeapType> heaps(vertices_cnt);
+        // Actual weight of the key is weight_ + offset[v], used if the heaps have no AddToAll.
+        std::vector<Weight> offset(kLazyShift ? 0 : vertices_cnt);
+        for (uint32_t i = 0; i < edges.size(); ++i) {
+            if (edges[i].from_ != edges[i].to_) {
+                heaps[edges[i].to_].Insert(Key{edges[i].weight_, i});
+            }
+        }
+
+        // Melds "source" into "target", their offsets become the same.
+        auto meld = [&](HeapType &target, Weight &target_offset, HeapType &source, Weight &source_offset) {
+            if constexpr (kLazyShift) {
+                target.Merge(source);
+            } else {
+                if (source.Empty()) {
+                    return;
+                }
+                // Heaps are swapped rather than melded where possible, some heaps meld in O(size).
+                if (target.Empty()) {
+                    std::swap(target, source);
+                    target_offset = source_offset;
+                    return;
+                }
+                if (target_offset == source_offset) {
+                    if (target.Size() < source.Size()) {
+                        std::swap(target, source);
+                    }
+                    target.Merge(source);
+                    return;
+                }
+                HeapType *smaller = &source;
+                HeapType *larger = &target;
+                Weight delta = source_offset - target_offset;
+                if (target.Size() < source.Size()) {
+                    std::swap(smaller, larger);
+                    delta = -delta;
+                    target_offset = source_offset;
+                }
+                while (!smaller->Empty()) {
+                    Key key = smaller->GetMinimum();
+                    smaller->ExtractMinimum();
+                    larger->Insert(Key{key.weight_ + delta, key.edge_});
+                }
+                if (larger != &target) {
+                    std::swap(target, *larger);
+                }
+            }
+        };
+
+        detail::DisjointSets components(vertices_cnt);
+        std::vector<uint32_t> seen(vertices_cnt, kUnseen);
+        std::vector<uint32_t> path(vertices_cnt);
+        Weight result = Weight();
+        Weight no_offset = Weight();
+        seen[root] = root;
+        for (uint32_t start = 0; start < vertices_cnt; ++start) {
+            uint32_t u = start;
+            size_t path_size = 0;
+            while (seen[u] == kUnseen) {
+                if (heaps[u].Empty()) {
+                    throw NoArborescenceException();
+                }
+                Key key = heaps[u].GetMinimum();
+                heaps[u].ExtractMinimum();
+                Weight weight = key.weight_;
+                // The rest of the incoming edges now cost relative to the chosen one.
+                if constexpr (kLazyShift) {
+                    heaps[u].AddToAll(Key{-weight, 0});
+                } else {
+                    weight += offset[u];
+                    offset[u] -= weight;
+                }
+                result += weight;
+                path[path_size++] = u;
+                seen[u] = start;
+                u = components.Find(edges[key.edge_].from_);
+                if (seen[u] == start) {
+                    // Contracting the cycle into one vertex
+                    HeapType cycle;
+                    Weight cycle_offset = Weight();
+                    uint32_t w;
+                    do {
+                        w = path[--path_size];
+                        meld(cycle, cycle_offset, heaps[w], kLazyShift ? no_offset : offset[w]);
+                    } while (components.Join(u, w));
+                    u = components.Find(u);
+                    meld(heaps[u], kLazyShift ? no_offset : offset[u], cycle, cycle_offset);
+                    seen[u] = kUnseen;
+                }
+            }
+        }
+        return result;
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_ALGORITHMS_ARBORESCENCE_H
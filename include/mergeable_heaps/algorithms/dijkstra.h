@@ -0,0 +1,46 @@
+#ifndef MERGEABLE_HEAPS_ALGORITHMS_DIJKSTRA_H
+#define MERGEABLE_HEAPS_ALGORITHMS_DIJKSTRA_H
+
+#include <limits>
+#include <utility>
+#include <vector>
+#include "graph.h"
+
+namespace heaps {
+    // Distance to the vertices, which are not reachable from the source
+    template<class Weight>
+    constexpr Weight kUnreachable = std::numeric_limits<Weight>::max();
+
+    // Single-source shortest paths for the non-negative weights.
+    // Heap is any mergeable heap template, e.g. heaps::LeftistHeap, it stores pairs (distance, vertex).
+    // The heaps don't support DecreaseKey, so the vertex is inserted again and stale entries are skipped.
+    // O(m log m) for the heaps with logarithmic operations.
+    template<template<class> class Heap, class Weight>
+    std::vector<Weight> Dijkstra(const CsrGraph<Weight> &graph, uint32_t source) {
+        std::vector<Weight> distance(graph.VerticesCount(), kUnreachable<Weight>);
+        Heap<std::pair<Weight, uint32_t>> heap;
+        distance[source] = Weight();
+        heap.Insert(std::make_pair(Weight(), source));
+        const uint64_t *offsets = graph.offsets_.data();
+        const uint32_t *targets = graph.targets_.data();
+        const Weight *weights = graph.weights_.data();
+        while (!heap.Empty()) {
+            const auto [d, v] = heap.GetMinimum();
+            heap.ExtractMinimum();
+            if (distance[v] < d) {
+                continue;
+            }
+            for (uint64_t i = offsets[v], end = offsets[v + 1]; i < end; ++i) {
+                const uint32_t u = targets[i];
+                const Weight candidate = d + weights[i];
+                if (candidate < distance[u]) {
+                    distance[u] = candidate;
+                    heap.Insert(std::make_pair(candidate, u));
+                }
+            }
+        }
+        return distance;
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_ALGORITHMS_DIJKSTRA_H
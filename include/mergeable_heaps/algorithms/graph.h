@@ -0,0 +1,73 @@
+#ifndef MERGEABLE_HEAPS_ALGORITHMS_GRAPH_H
+#define MERGEABLE_HEAPS_ALGORITHMS_GRAPH_H
+
+#include <cstdint>
+#include <vector>
+
+namespace heaps {
+    // Directed weighted edge
+    template<class Weight>
+    struct Edge {
+        uint32_t from_;
+        uint32_t to_;
+        Weight weight_;
+    };
+
+    // Directed graph in the compressed sparse row format.
+    // Edges going out of v are [offsets_[v], offsets_[v + 1]), their targets and weights are stored
+    // in separate arrays, so the inner loops of the algorithms read memory sequentially.
+    template<class Weight>
+    class CsrGraph {
+    public:
+        std::vector<uint64_t> offsets_;
+        std::vector<uint32_t> targets_;
+        std::vector<Weight> weights_;
+
+        // Builds the graph from the list of edges in O(n + m).
+        // If "undirected" is true, every edge is added in both directions.
+        CsrGraph(size_t vertices_cnt, const std::vector<Edge<Weight>> &edges, bool undirected = false);
+
+        size_t VerticesCount() const;
+
+        size_t EdgesCount() const;
+    };
+
+    template<class Weight>
+    CsrGraph<Weight>::CsrGraph(size_t vertices_cnt, const std::vector<Edge<Weight>> &edges, bool undirected) :
+            offsets_(vertices_cnt + 1, 0) {
+        for (const auto &edge: edges) {
+            ++offsets_[edge.from_ + 1];
+            if (undirected) {
+                ++offsets_[edge.to_ + 1];
+            }
+        }
+        for (size_t v = 0; v < vertices_cnt; ++v) {
+            offsets_[v + 1] += offsets_[v];
+        }
+        targets_.resize(offsets_[vertices_cnt]);
+        weights_.resize(offsets_[vertices_cnt]);
+        std::vector<uint64_t> position(offsets_.begin(), offsets_.end() - 1);
+        for (const auto &edge: edges) {
+            uint64_t i = position[edge.from_]++;
+            targets_[i] = edge.to_;
+            weights_[i] = edge.weight_;
+            if (undirected) {
+                i = position[edge.to_]++;
+                targets_[i] = edge.from_;
+                weights_[i] = edge.weight_;
+            }
+        }
+    }
+
+    template<class Weight>
+    size_t CsrGraph<Weight>::VerticesCount() const {
+        return offsets_.size() - 1;
+    }
+
+    template<class Weight>
+    size_t CsrGraph<Weight>::EdgesCount() const {
+        return targets_.size();
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_ALGORITHMS_GRAPH_H
@@ -0,0 +1,42 @@
+#ifndef MERGEABLE_HEAPS_ALGORITHMS_HUFFMAN_H
+#define MERGEABLE_HEAPS_ALGORITHMS_HUFFMAN_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace heaps {
+    // Lengths of the Huffman codes for the symbols with the given frequencies.
+    // Heap is any mergeable heap template, it stores pairs (frequency, tree node).
+    // A single symbol gets the code of length 1. O(n log n) for the heaps with logarithmic operations.
+    template<template<class> class Heap>
+    std::vector<uint32_t> HuffmanCodeLengths(const std::vector<uint64_t> &frequencies) {
+        const size_t n = frequencies.size();
+        if (n <= 1) {
+            return std::vector<uint32_t>(n, 1);
+        }
+        // Leaves are 0..n-1, inner nodes are n..2n-2, parent of the root is itself.
+        std::vector<uint32_t> parent(2 * n - 1);
+        Heap<std::pair<uint64_t, uint32_t>> heap;
+        for (uint32_t i = 0; i < n; ++i) {
+            heap.Insert(std::make_pair(frequencies[i], i));
+        }
+        for (auto node = static_cast<uint32_t>(n); node < 2 * n - 1; ++node) {
+            const auto first = heap.GetMinimum();
+            heap.ExtractMinimum();
+            const auto second = heap.GetMinimum();
+            heap.ExtractMinimum();
+            parent[first.second] = parent[second.second] = node;
+            heap.Insert(std::make_pair(first.first + second.first, node));
+        }
+        // Parents have greater indices, so depths are computed from the root down.
+        std::vector<uint32_t> depth(2 * n - 1, 0);
+        for (auto node = static_cast<uint32_t>(2 * n - 2); node-- > 0;) {
+            depth[node] = depth[parent[node]] + 1;
+        }
+        depth.resize(n);
+        return depth;
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_ALGORITHMS_HUFFMAN_H
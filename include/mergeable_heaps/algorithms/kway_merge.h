@@ -0,0 +1,52 @@
+#ifndef MERGEABLE_HEAPS_ALGORITHMS_KWAY_MERGE_H
+#define MERGEABLE_HEAPS_ALGORITHMS_KWAY_MERGE_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace heaps {
+    // Merges sorted runs into one sorted sequence.
+    // Heap is any mergeable heap template, it stores pairs (value, run) for the heads of the runs,
+    // so equal values are taken in the order of the runs. O(n log k) for the heaps with logarithmic operations.
+    template<template<class> class Heap, class T>
+    std::vector<T> KWayMerge(const std::vector<std::vector<T>> &runs) {
+        size_t total = 0;
+        for (const auto &run: runs) {
+            total += run.size();
+        }
+        std::vector<T> result;
+        result.reserve(total);
+        std::vector<size_t> position(runs.size(), 0);
+        Heap<std::pair<T, uint32_t>> heap;
+        for (uint32_t i = 0; i < runs.size(); ++i) {
+            if (!runs[i].empty()) {
+                heap.Insert(std::make_pair(runs[i][0], i));
+            }
+        }
+        while (!heap.Empty()) {
+            const uint32_t run = heap.GetMinimum().second;
+            heap.ExtractMinimum();
+            const auto &values = runs[run];
+            size_t i = position[run];
+            // The run is copied, while it stays below the smallest head of the other runs,
+            // so long sorted stretches cost one heap operation.
+            result.push_back(values[i++]);
+            if (heap.Empty()) {
+                result.insert(result.end(), values.begin() + static_cast<std::ptrdiff_t>(i), values.end());
+                break;
+            }
+            const auto next = heap.GetMinimum();
+            while (i < values.size() && std::make_pair(values[i], run) < next) {
+                result.push_back(values[i++]);
+            }
+            position[run] = i;
+            if (i < values.size()) {
+                heap.Insert(std::make_pair(values[i], run));
+            }
+        }
+        return result;
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_ALGORITHMS_KWAY_MERGE_H
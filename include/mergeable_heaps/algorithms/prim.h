@@ -0,0 +1,63 @@
+#ifndef MERGEABLE_HEAPS_ALGORITHMS_PRIM_H
+#define MERGEABLE_HEAPS_ALGORITHMS_PRIM_H
+
+#include <limits>
+#include <utility>
+#include <vector>
+#include "graph.h"
+
+namespace heaps {
+    // Minimum spanning forest found by Prim's algorithm
+    template<class Weight>
+    struct SpanningForest {
+        // Sum of the weights of the chosen edges
+        Weight weight_;
+        // parent_[v] is the other end of the edge, which connects v to the forest.
+        // Roots of the trees are their own parents.
+        std::vector<uint32_t> parent_;
+    };
+
+    // Minimum spanning forest of the undirected graph, every edge must be present in both directions.
+    // Heap is any mergeable heap template, it stores tuples (weight, vertex, parent) with lazy deletion.
+    // O(m log m) for the heaps with logarithmic operations.
+    template<template<class> class Heap, class Weight>
+    SpanningForest<Weight> Prim(const CsrGraph<Weight> &graph) {
+        const size_t n = graph.VerticesCount();
+        SpanningForest<Weight> forest{Weight(), std::vector<uint32_t>(n)};
+        std::vector<bool> in_tree(n, false);
+        // The lightest edge seen so far for every vertex, prunes the insertions of heavier ones.
+        std::vector<Weight> best(n, std::numeric_limits<Weight>::max());
+        Heap<std::pair<Weight, std::pair<uint32_t, uint32_t>>> heap;
+        const uint64_t *offsets = graph.offsets_.data();
+        const uint32_t *targets = graph.targets_.data();
+        const Weight *weights = graph.weights_.data();
+
+        for (uint32_t root = 0; root < n; ++root) {
+            if (in_tree[root]) {
+                continue;
+            }
+            heap.Insert(std::make_pair(Weight(), std::make_pair(root, root)));
+            while (!heap.Empty()) {
+                const auto [w, edge] = heap.GetMinimum();
+                heap.ExtractMinimum();
+                const auto [v, parent] = edge;
+                if (in_tree[v]) {
+                    continue;
+                }
+                in_tree[v] = true;
+                forest.parent_[v] = parent;
+                forest.weight_ += w;
+                for (uint64_t i = offsets[v], end = offsets[v + 1]; i < end; ++i) {
+                    const uint32_t u = targets[i];
+                    if (!in_tree[u] && weights[i] < best[u]) {
+                        best[u] = weights[i];
+                        heap.Insert(std::make_pair(weights[i], std::make_pair(u, v)));
+                    }
+                }
+            }
+        }
+        return forest;
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_ALGORITHMS_PRIM_H
@@ -5,11 +5,18 @@
 #include <algorithm>
 #include "heap_interface.h"
 #include "exceptions.h"
+#include "inline_heap.h"
+#include "insert_buffer.h"
+#include "parallel_drain.h"
 #include "nodes/binomial_heap_node.h"
 
 namespace heaps {
     // Binomial Heap implementation. Key is the type of data stored
-    template<class Key>
+    // Up to InlineCapacity keys are stored in the heap object itself as a small array heap,
+    // the heap switches to the trees, when there are more keys or it's merged with a tree heap.
+    // With BufferInserts the inserted keys are appended to an unsorted buffer, which is linked into binomial trees
+    // in O(b) and melded once on the next ExtractMinimum or Merge. GetMinimum doesn't meld the buffer.
+    template<class Key, size_t InlineCapacity = 0, bool BufferInserts = false>
     class BinomialHeap : public HeapInterface<Key> {
     private:
         // Link to the root of the tree with the minimal degree.
@@ -21,6 +28,16 @@ namespace heaps {
         // They will throw a RestrictedMethodException for Size() and Empty() methods.
         bool is_temporary_;
         size_t size_;
+        // Keys of the small heap. Not used, when there are trees.
+        [[no_unique_address]] InlineHeap<Key, InlineCapacity> inline_;
+        // Keys inserted since the last extraction or merge
+        [[no_unique_address]] InsertBuffer<Key, BufferInserts> buffer_;
+
+        // Moves the inline keys into the trees.
+        void Promote();
+
+        // Adds the one-node tree with the key, size_ is not changed.
+        void InsertNode(Key x);
 
         // Method finds the minimal node in the heap and returns pointer.
         // Throws an EmptyHeapException(), if there is none
@@ -33,11 +50,11 @@ namespace heaps {
         // The method cuts the vertex off its children and then destroys it.
         // The node itself is destroyed. The children are organised into the returning heap.
         // Heap has some restricted methods and it marked temporary.
-        BinomialHeap<Key> CutVertex(BinomialHeapNode<Key> *v);
+        BinomialHeap<Key, InlineCapacity, BufferInserts> CutVertex(BinomialHeapNode<Key> *v);
 
         // Methods merges heap "x" to *this heap.
         // heap "x" becomes empty.
-        void Merge_(BinomialHeap<Key> &x);
+        void Merge_(BinomialHeap<Key, InlineCapacity, BufferInserts> &x);
 
         // Method merges two lists of roots using merge sort
         // It returns the pointer to the head of the list, where
@@ -57,6 +74,8 @@ namespace heaps {
         void Detach() override;
 
     public:
+        // Size of one node of the trees in bytes
+        static constexpr size_t kNodeBytes = sizeof(BinomialHeapNode<Key>);
 
         // Constructor for one-item heap
         explicit BinomialHeap(Key key);
@@ -85,6 +104,27 @@ namespace heaps {
         // Return true if heap is empty, false otherwise, may be restricted.
         bool Empty() override;
 
+        // Returns true, if the keys are stored inline.
+        bool IsInline() const;
+
+        // Number of the keys waiting in the insert buffer
+        size_t BufferedSize() const;
+
+        // Melds the buffered keys into the trees. Called by ExtractMinimum and Merge.
+        void Flush();
+
+        // Passes all the keys to callback in no particular order and deletes the nodes on the way.
+        // The heap becomes empty. O(n)
+        template<class Callback>
+        void TakeKeys(Callback &&callback);
+
+        // Writes all the keys to out in the order of the repeated ExtractMinimum and returns the end of the output.
+        // The roots of the largest trees are cut off, until there are enough trees for the threads.
+        // The trees are drained into sorted runs in parallel, the largest first, then the runs are merged in parallel.
+        // Nodes are deleted, while they are drained. The heap becomes empty.
+        template<class OutputIt>
+        OutputIt DrainSorted(OutputIt out, size_t threads_cnt);
+
         // Returns sorted std::vector with all the keys from the heap.
         // Mainly for debug purposes.
         std::vector<Key> Data();
@@ -95,39 +135,89 @@ namespace heaps {
 
         // Destructor. Destructs the heap with all it's nodes
         // Unless they are detached.
-        ~BinomialHeap<Key>();
+        ~BinomialHeap();
 
         // Copy constructor. Creates the copy of the heap and all it's nodes
-        BinomialHeap<Key>(const BinomialHeap<Key> &other);
+        BinomialHeap(const BinomialHeap<Key, InlineCapacity, BufferInserts> &other);
 
         // Move constructor. Creates the copy of the heap by stealing resources.
         // Other heap is left as newly initialized.
-        BinomialHeap<Key>(BinomialHeap<Key> &&other) noexcept;
+        BinomialHeap(BinomialHeap<Key, InlineCapacity, BufferInserts> &&other) noexcept;
 
         // Copy assignment operator
-        BinomialHeap<Key> &operator=(const BinomialHeap<Key> &other);
+        BinomialHeap<Key, InlineCapacity, BufferInserts> &operator=(const BinomialHeap<Key, InlineCapacity, BufferInserts> &other);
 
         // Move assignment operator
-        BinomialHeap<Key> &operator=(BinomialHeap<Key> &&other) noexcept;
+        BinomialHeap<Key, InlineCapacity, BufferInserts> &operator=(BinomialHeap<Key, InlineCapacity, BufferInserts> &&other) noexcept;
 
         // Swap function for "Copy and Swap" idiom
-        void Swap(BinomialHeap<Key> &x) noexcept;
+        void Swap(BinomialHeap<Key, InlineCapacity, BufferInserts> &x) noexcept;
     };
 
-    template<class Key>
-    void BinomialHeap<Key>::Insert(Key x) {
-        BinomialHeap<Key> tmp(x);
-        Merge(tmp);
-        // Now tmp is empty and will be destructed.
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    void BinomialHeap<Key, InlineCapacity, BufferInserts>::Insert(Key x) {
+        if constexpr (BufferInserts) {
+            buffer_.Push(x);
+            ++size_;
+            return;
+        }
+        if constexpr (InlineCapacity > 0) {
+            if (root_ == nullptr) {
+                if (!inline_.Full()) {
+                    inline_.Push(x);
+                    ++size_;
+                    return;
+                }
+                Promote();
+            }
+        }
+        InsertNode(x);
+        ++size_;
+    }
+
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    void BinomialHeap<Key, InlineCapacity, BufferInserts>::InsertNode(Key x) {
+        BinomialHeap<Key, InlineCapacity, BufferInserts> tmp(new BinomialHeapNode<Key>(x, nullptr, nullptr, nullptr, 0u));
+        Merge_(tmp);
+        tmp.Detach();
+    }
+
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    void BinomialHeap<Key, InlineCapacity, BufferInserts>::Promote() {
+        if constexpr (InlineCapacity > 0) {
+            for (const auto &key: inline_) {
+                InsertNode(key);
+            }
+            inline_.Clear();
+        }
     }
 
-    template<class Key>
-    Key BinomialHeap<Key>::GetMinimum() {
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    Key BinomialHeap<Key, InlineCapacity, BufferInserts>::GetMinimum() {
+        if constexpr (BufferInserts) {
+            if (!buffer_.Empty()) {
+                if (root_ != nullptr) {
+                    const Key &minimum = FindMinimalNode()->key_;
+                    return minimum < buffer_.Min() ? minimum : buffer_.Min();
+                }
+                if constexpr (InlineCapacity > 0) {
+                    if (!inline_.Empty() && inline_.Top() < buffer_.Min()) {
+                        return inline_.Top();
+                    }
+                }
+                return buffer_.Min();
+            }
+        }
+        if constexpr (InlineCapacity > 0) {
+            if (root_ == nullptr && !inline_.Empty()) {
+                return inline_.Top();
+            }
+        }
         return FindMinimalNode()->key_;
     }
 
-    template<class Key>
-    void BinomialHeap<Key>::ExtractTopVertex(BinomialHeapNode<Key> *v) {
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    void BinomialHeap<Key, InlineCapacity, BufferInserts>::ExtractTopVertex(BinomialHeapNode<Key> *v) {
         BinomialHeapNode<Key> *predecessor = nullptr;
         for (BinomialHeapNode<Key> *i = root_; i != v; i = i->sibling_) {
             predecessor = i;
@@ -137,20 +227,28 @@ namespace heaps {
         } else {
             predecessor->sibling_ = v->sibling_;
         }
-        BinomialHeap<Key> tmp(std::move(CutVertex(v)));
+        BinomialHeap<Key, InlineCapacity, BufferInserts> tmp(std::move(CutVertex(v)));
         Merge(tmp);
         // Decreasing size and disabling restricting
         size_ -= 1;
         is_temporary_ = false;
     }
 
-    template<class Key>
-    void BinomialHeap<Key>::ExtractMinimum() {
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    void BinomialHeap<Key, InlineCapacity, BufferInserts>::ExtractMinimum() {
+        Flush();
+        if constexpr (InlineCapacity > 0) {
+            if (root_ == nullptr && !inline_.Empty()) {
+                inline_.Pop();
+                --size_;
+                return;
+            }
+        }
         ExtractTopVertex(FindMinimalNode());
     }
 
-    template<class Key>
-    void BinomialHeap<Key>::Merge_(BinomialHeap<Key> &x) {
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    void BinomialHeap<Key, InlineCapacity, BufferInserts>::Merge_(BinomialHeap<Key, InlineCapacity, BufferInserts> &x) {
         if (root_ == nullptr || x.root_ == nullptr) {
             root_ = root_ == nullptr ? x.root_ : root_;
             return;
@@ -160,20 +258,36 @@ namespace heaps {
         BinomialHeapNode<Key>::Raise(root_);
     }
 
-    template<class Key>
-    void BinomialHeap<Key>::Merge(HeapInterface<Key> &x) {
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    void BinomialHeap<Key, InlineCapacity, BufferInserts>::Merge(HeapInterface<Key> &x) {
         if (&x == this) {
             throw SelfHeapMergeException();
         }
         try {
-            auto &casted = dynamic_cast<BinomialHeap<Key> &>(x);
+            auto &casted = dynamic_cast<BinomialHeap<Key, InlineCapacity, BufferInserts> &>(x);
+            Flush();
+            casted.Flush();
+            if constexpr (InlineCapacity > 0) {
+                // Small heaps stay inline, while they fit.
+                if (root_ == nullptr && casted.root_ == nullptr &&
+                    !is_temporary_ && size_ + casted.size_ <= InlineCapacity) {
+                    for (const auto &key: casted.inline_) {
+                        inline_.Push(key);
+                    }
+                    size_ += casted.size_;
+                    x.Detach();
+                    return;
+                }
+                Promote();
+                casted.Promote();
+            }
             Merge_(casted);
-            // Trying to update size.
             // If merged heap was temporary, we can't rely on the size field again.
-            try {
-                size_ += casted.Size();
-            } catch (const RestrictedMethodException &e) {
+            // The flag is checked directly, as throwing on every extraction is expensive.
+            if (casted.is_temporary_) {
                 is_temporary_ = true;
+            } else {
+                size_ += casted.size_;
             }
             x.Detach();
         } catch (const std::bad_cast &e) {
@@ -181,21 +295,21 @@ namespace heaps {
         }
     }
 
-    template<class Key>
-    BinomialHeap<Key>::BinomialHeap(Key key) : size_(1), is_temporary_(false) {
-        root_ = new BinomialHeapNode<Key>(key, nullptr, nullptr, nullptr, 0u);
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    BinomialHeap<Key, InlineCapacity, BufferInserts>::BinomialHeap(Key key) : BinomialHeap() {
+        Insert(key);
     }
 
-    template<class Key>
-    size_t BinomialHeap<Key>::Size() {
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    size_t BinomialHeap<Key, InlineCapacity, BufferInserts>::Size() {
         if (is_temporary_) {
             throw RestrictedMethodException();
         }
         return size_;
     }
 
-    template<class Key>
-    BinomialHeapNode<Key> *BinomialHeap<Key>::FindMinimalNode() {
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    BinomialHeapNode<Key> *BinomialHeap<Key, InlineCapacity, BufferInserts>::FindMinimalNode() {
         if (root_ == nullptr) {
             throw EmptyHeapException();
         }
@@ -208,34 +322,28 @@ namespace heaps {
         return minimal_node;
     }
 
-    // TODO DetachSibling
-    template<class Key>
-    BinomialHeap<Key> BinomialHeap<Key>::CutVertex(BinomialHeapNode<Key> *v) {
-        BinomialHeapNode<Key> *first = v->child_;
-        if (first == nullptr) {
-            return BinomialHeap<Key>();
-        }
-        BinomialHeapNode<Key> *next = first->sibling_;
-        first->parent_ = nullptr;
-        first->sibling_ = nullptr;
-        BinomialHeap<Key> new_heap(first);
-        BinomialHeapNode<Key>* rightmost = new_heap.root_;
-        for (BinomialHeapNode<Key> *i = next; i != nullptr; i = next) {
-            BinomialHeapNode<Key> *current = i;
-            next = current->sibling_;
-            current->sibling_ = nullptr;
-            current->parent_ = nullptr;
-
-            rightmost->sibling_ = current;
-            rightmost = current;
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    BinomialHeap<Key, InlineCapacity, BufferInserts> BinomialHeap<Key, InlineCapacity, BufferInserts>::CutVertex(BinomialHeapNode<Key> *v) {
+        // Children are stored in descending order of degrees,
+        // while the list of roots must be ascending, so the list is reversed.
+        BinomialHeapNode<Key> *head = nullptr;
+        for (BinomialHeapNode<Key> *i = v->child_; i != nullptr;) {
+            BinomialHeapNode<Key> *next = i->sibling_;
+            i->parent_ = nullptr;
+            i->sibling_ = head;
+            head = i;
+            i = next;
         }
         v->Detach();
         delete v;
-        return new_heap;
+        if (head == nullptr) {
+            return BinomialHeap<Key, InlineCapacity, BufferInserts>();
+        }
+        return BinomialHeap<Key, InlineCapacity, BufferInserts>(head);
     }
 
-    template<class Key>
-    BinomialHeapNode<Key> *BinomialHeap<Key>::MergeRootsAsLists(BinomialHeapNode<Key> *v1, BinomialHeapNode<Key> *v2) {
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    BinomialHeapNode<Key> *BinomialHeap<Key, InlineCapacity, BufferInserts>::MergeRootsAsLists(BinomialHeapNode<Key> *v1, BinomialHeapNode<Key> *v2) {
         BinomialHeapNode<Key> *cur[] = {v1, v2};
         BinomialHeapNode<Key> *head = nullptr;
         BinomialHeapNode<Key> *current = nullptr;
@@ -260,70 +368,127 @@ namespace heaps {
         return head;
     }
 
-    template<class Key>
-    void BinomialHeap<Key>::MakeDegreesUnique(BinomialHeapNode<Key> *v) {
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    void BinomialHeap<Key, InlineCapacity, BufferInserts>::MakeDegreesUnique(BinomialHeapNode<Key> *v) {
         BinomialHeapNode<Key> *previous = nullptr;
         while (v->sibling_ != nullptr) {
-            if (v->degree_ == v->sibling_->degree_) {
-                if (v->key_ < v->sibling_->key_) {
-                    BinomialHeapNode<Key> *next = v->sibling_->sibling_;
-                    v->Merge_(v->sibling_);
-                    v->sibling_ = next;
-                } else {
-                    v->sibling_->Merge_(v);
-                    v = v->parent_;
-                    if (previous != nullptr) {
-                        previous->sibling_ = v;
-                    }
-                }
+            BinomialHeapNode<Key> *next = v->sibling_;
+            // Trees are linked only if exactly two of them in a row have the same degree.
+            // Linking the first two of three would break the order of degrees in the list.
+            if (v->degree_ != next->degree_ ||
+                (next->sibling_ != nullptr && next->sibling_->degree_ == v->degree_)) {
+                previous = v;
+                v = next;
+            } else if (v->key_ < next->key_) {
+                v->sibling_ = next->sibling_;
+                v->Merge_(next);
             } else {
                 if (previous != nullptr) {
-                    previous->sibling_ = v;
+                    previous->sibling_ = next;
                 }
-                previous = v;
-                v = v->sibling_;
+                next->Merge_(v);
+                v = next;
             }
         }
     }
 
-    template<class Key>
-    BinomialHeap<Key>::BinomialHeap() : root_(nullptr), is_temporary_(false), size_(0) {}
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    BinomialHeap<Key, InlineCapacity, BufferInserts>::BinomialHeap() : root_(nullptr), is_temporary_(false), size_(0) {}
 
-    template<class Key>
-    bool BinomialHeap<Key>::Empty() {
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    bool BinomialHeap<Key, InlineCapacity, BufferInserts>::Empty() {
         if (is_temporary_) {
             throw RestrictedMethodException();
         }
         return size_ == 0;
     }
 
-    template<class Key>
-    BinomialHeap<Key>::BinomialHeap(BinomialHeapNode<Key> *root) : root_(root), is_temporary_(true), size_(0) {}
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    BinomialHeap<Key, InlineCapacity, BufferInserts>::BinomialHeap(BinomialHeapNode<Key> *root) : root_(root), is_temporary_(true), size_(0) {}
 
-    template<class Key>
-    void BinomialHeap<Key>::Detach() {
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    void BinomialHeap<Key, InlineCapacity, BufferInserts>::Detach() {
         root_ = nullptr;
         size_ = 0;
+        inline_.Clear();
+        buffer_.Clear();
+    }
+
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    bool BinomialHeap<Key, InlineCapacity, BufferInserts>::IsInline() const {
+        return root_ == nullptr;
+    }
+
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    size_t BinomialHeap<Key, InlineCapacity, BufferInserts>::BufferedSize() const {
+        return buffer_.Size();
+    }
+
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    void BinomialHeap<Key, InlineCapacity, BufferInserts>::Flush() {
+        if constexpr (BufferInserts) {
+            if (buffer_.Empty()) {
+                return;
+            }
+            if constexpr (InlineCapacity > 0) {
+                if (root_ == nullptr && inline_.Size() + buffer_.Size() <= InlineCapacity) {
+                    for (const auto &key: buffer_) {
+                        inline_.Push(key);
+                    }
+                    buffer_.Clear();
+                    return;
+                }
+                Promote();
+            }
+            // The keys are added to the trees like the ones to a binary counter, trees[d] is the tree of degree d.
+            // b additions link O(b) trees in total.
+            std::vector<BinomialHeapNode<Key> *> trees;
+            for (const auto &key: buffer_) {
+                auto *carry = new BinomialHeapNode<Key>(key, nullptr, nullptr, nullptr, 0u);
+                size_t degree = 0;
+                for (; degree < trees.size() && trees[degree] != nullptr; ++degree) {
+                    if (trees[degree]->key_ < carry->key_) {
+                        std::swap(trees[degree], carry);
+                    }
+                    carry->Merge_(trees[degree]);
+                    trees[degree] = nullptr;
+                }
+                if (degree == trees.size()) {
+                    trees.push_back(nullptr);
+                }
+                trees[degree] = carry;
+            }
+            BinomialHeapNode<Key> *head = nullptr;
+            for (auto it = trees.rbegin(); it != trees.rend(); ++it) {
+                if (*it != nullptr) {
+                    (*it)->sibling_ = head;
+                    head = *it;
+                }
+            }
+            BinomialHeap tmp(head);
+            Merge_(tmp);
+            tmp.Detach();
+            buffer_.Clear();
+        }
     }
 
     // Destructor
-    template<class Key>
-    BinomialHeap<Key>::~BinomialHeap<Key>() {
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    BinomialHeap<Key, InlineCapacity, BufferInserts>::~BinomialHeap() {
         if (root_ != nullptr) {
             delete root_;
         }
     }
 
     // Copy constructor
-    template<class Key>
-    BinomialHeap<Key>::BinomialHeap(const BinomialHeap<Key> &other) : size_(other.size_),
-                                                                      root_(new BinomialHeapNode<Key>(*other.root_)) {
-        is_temporary_ = other.is_temporary_;
-    }
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    BinomialHeap<Key, InlineCapacity, BufferInserts>::BinomialHeap(const BinomialHeap<Key, InlineCapacity, BufferInserts> &other) :
+            root_(other.root_ == nullptr ? nullptr : new BinomialHeapNode<Key>(*other.root_)),
+            is_temporary_(other.is_temporary_), size_(other.size_), inline_(other.inline_), buffer_(other.buffer_) {}
 
     // Move constructor
-    template<class Key>
-    BinomialHeap<Key>::BinomialHeap(BinomialHeap<Key> &&other) noexcept {
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    BinomialHeap<Key, InlineCapacity, BufferInserts>::BinomialHeap(BinomialHeap<Key, InlineCapacity, BufferInserts> &&other) noexcept {
         root_ = nullptr;
         size_ = 0;
         is_temporary_ = false;
@@ -331,8 +496,8 @@ namespace heaps {
     }
 
     // Copy assignment operator
-    template<class Key>
-    BinomialHeap<Key> &BinomialHeap<Key>::operator=(const BinomialHeap<Key> &other) {
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    BinomialHeap<Key, InlineCapacity, BufferInserts> &BinomialHeap<Key, InlineCapacity, BufferInserts>::operator=(const BinomialHeap<Key, InlineCapacity, BufferInserts> &other) {
         if (this != &other) {
             BinomialHeap tmp(other);
             Swap(tmp);
@@ -341,26 +506,99 @@ namespace heaps {
     }
 
     // Move assignment operator
-    template<class Key>
-    BinomialHeap<Key> &BinomialHeap<Key>::operator=(BinomialHeap<Key> &&other) noexcept {
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    BinomialHeap<Key, InlineCapacity, BufferInserts> &BinomialHeap<Key, InlineCapacity, BufferInserts>::operator=(BinomialHeap<Key, InlineCapacity, BufferInserts> &&other) noexcept {
         if (this != &other) {
-            root_ = nullptr;
-            size_ = 0;
-            is_temporary_ = false;
-            Swap(other);
+            BinomialHeap tmp(std::move(other));
+            Swap(tmp);
         }
         return *this;
     }
 
-    template<class Key>
-    void BinomialHeap<Key>::Swap(BinomialHeap<Key> &x) noexcept {
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    void BinomialHeap<Key, InlineCapacity, BufferInserts>::Swap(BinomialHeap<Key, InlineCapacity, BufferInserts> &x) noexcept {
         std::swap(root_, x.root_);
+        std::swap(is_temporary_, x.is_temporary_);
         std::swap(size_, x.size_);
+        inline_.Swap(x.inline_);
+        buffer_.Swap(x.buffer_);
+    }
+
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    template<class Callback>
+    void BinomialHeap<Key, InlineCapacity, BufferInserts>::TakeKeys(Callback &&callback) {
+        for (const auto &key: inline_) {
+            callback(key);
+        }
+        for (const auto &key: buffer_) {
+            callback(key);
+        }
+        inline_.Clear();
+        buffer_.Clear();
+        BinomialHeapNode<Key>::TakeKeys(root_, callback);
+        root_ = nullptr;
+        is_temporary_ = false;
+        size_ = 0;
+    }
+
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    template<class OutputIt>
+    OutputIt BinomialHeap<Key, InlineCapacity, BufferInserts>::DrainSorted(OutputIt out, size_t threads_cnt) {
+        threads_cnt = std::max<size_t>(threads_cnt, 1);
+        // The inline and the buffered keys are sorted as they are.
+        std::vector<std::vector<Key>> runs(2);
+        runs[0].assign(inline_.begin(), inline_.end());
+        runs[0].insert(runs[0].end(), buffer_.begin(), buffer_.end());
+        std::sort(runs[0].begin(), runs[0].end());
+        std::vector<BinomialHeapNode<Key> *> pieces;
+        for (BinomialHeapNode<Key> *v = root_; v != nullptr;) {
+            BinomialHeapNode<Key> *next = v->sibling_;
+            v->sibling_ = nullptr;
+            pieces.push_back(v);
+            v = next;
+        }
+        Detach();
+        auto larger = [](const BinomialHeapNode<Key> *a, const BinomialHeapNode<Key> *b) {
+            return a->degree_ > b->degree_;
+        };
+        // A tree of degree d splits into the trees of degrees 0..d-1, a few trees per thread even out the sizes.
+        const size_t pieces_cnt = threads_cnt == 1 ? 1 : 8 * threads_cnt;
+        std::sort(pieces.begin(), pieces.end(), larger);
+        while (pieces.size() < pieces_cnt && !pieces.empty() && pieces[0]->degree_ > 0) {
+            BinomialHeapNode<Key> *v = pieces[0];
+            pieces.erase(pieces.begin());
+            runs[1].push_back(v->key_);
+            for (BinomialHeapNode<Key> *i = v->child_; i != nullptr;) {
+                BinomialHeapNode<Key> *next = i->sibling_;
+                i->parent_ = nullptr;
+                i->sibling_ = nullptr;
+                pieces.push_back(i);
+                i = next;
+            }
+            v->Detach();
+            delete v;
+            std::sort(pieces.begin(), pieces.end(), larger);
+        }
+        std::sort(runs[1].begin(), runs[1].end());
+        runs.resize(2 + pieces.size());
+        detail::ParallelFor(pieces.size(), threads_cnt, [&](size_t i) {
+            BinomialHeap tree;
+            tree.root_ = pieces[i];
+            tree.size_ = size_t(1) << pieces[i]->degree_;
+            runs[2 + i].reserve(tree.size_);
+            while (tree.root_ != nullptr) {
+                BinomialHeapNode<Key> *v = tree.FindMinimalNode();
+                runs[2 + i].push_back(v->key_);
+                tree.ExtractTopVertex(v);
+            }
+        });
+        return detail::MergeRuns(runs, out, threads_cnt);
     }
 
-    template<class Key>
-    std::vector<Key> BinomialHeap<Key>::Data() {
-        std::vector<Key> data;
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    std::vector<Key> BinomialHeap<Key, InlineCapacity, BufferInserts>::Data() {
+        std::vector<Key> data(inline_.begin(), inline_.end());
+        data.insert(data.end(), buffer_.begin(), buffer_.end());
         if (root_ != nullptr) {
             root_->CollectData(data);
         }
@@ -0,0 +1,19 @@
+#ifndef MERGEABLE_HEAPS_BLOCKED_LEFTIST_H
+#define MERGEABLE_HEAPS_BLOCKED_LEFTIST_H
+
+#include "blocked_heap.h"
+#include "nodes/blocked_leftist_heap_node.h"
+
+namespace heaps {
+    // Leftist Heap, which nodes store blocks of up to Capacity keys.
+    // Best suited for small arithmetic keys, int and float blocks are searched with SIMD.
+    template<class Key = int, size_t Capacity = 8>
+    class BlockedLeftistHeap : public BlockedHeap<Key, BlockedLeftistHeapNode<Key, Capacity>> {
+        using Base = BlockedHeap<Key, BlockedLeftistHeapNode<Key, Capacity>>;
+    public:
+        // Importing Base's constructors
+        using Base::Base;
+    };
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_BLOCKED_LEFTIST_H
@@ -0,0 +1,19 @@
+#ifndef MERGEABLE_HEAPS_BLOCKED_SKEW_H
+#define MERGEABLE_HEAPS_BLOCKED_SKEW_H
+
+#include "blocked_heap.h"
+#include "nodes/blocked_skew_heap_node.h"
+
+namespace heaps {
+    // Skew Heap, which nodes store blocks of up to Capacity keys.
+    // Best suited for small arithmetic keys, int and float blocks are searched with SIMD.
+    template<class Key = int, size_t Capacity = 8>
+    class BlockedSkewHeap : public BlockedHeap<Key, BlockedSkewHeapNode<Key, Capacity>> {
+        using Base = BlockedHeap<Key, BlockedSkewHeapNode<Key, Capacity>>;
+    public:
+        // Importing Base's constructors
+        using Base::Base;
+    };
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_BLOCKED_SKEW_H
@@ -0,0 +1,183 @@
+#ifndef MERGEABLE_HEAPS_BOUNDED_H
+#define MERGEABLE_HEAPS_BOUNDED_H
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "exceptions.h"
+#include "conversion.h"
+#include "leftist_heap.h"
+
+namespace heaps {
+    namespace detail {
+        // Bytes taken by one key of the heap. Node size for the heaps, which report it.
+        template<class Heap, class Key, class = void>
+        struct NodeBytes : std::integral_constant<size_t, sizeof(Key) + 2 * sizeof(void *)> {};
+
+        template<class Heap, class Key>
+        struct NodeBytes<Heap, Key, std::void_t<decltype(Heap::kNodeBytes)>>
+                : std::integral_constant<size_t, Heap::kNodeBytes> {};
+    } // namespace detail
+
+    // What BoundedHeap does with a new key, when it's full
+    enum class OverflowPolicy {
+        // The worst key is evicted, if the new one is better.
+        kEvict,
+        // The new key is rejected.
+        kReject,
+    };
+
+    // Heap, which keeps at most Capacity best (greatest) keys of a stream.
+    // The keys are stored in a min-ordered Heap, so the worst kept key, the eviction boundary,
+    // is its minimum. Offer is O(log K), Boundary is the GetMinimum of the Heap.
+    // Merge keeps the best Capacity keys of the both heaps. If they don't fit, the keys are selected
+    // with nth_element and rebuilt with BulkBuilder, O(K) for the heaps with TakeKeys.
+    template<class Key, template<class> class Heap = LeftistHeap>
+    class BoundedHeap {
+    public:
+        // Approximate number of bytes taken by one kept key
+        static constexpr size_t kBytesPerKey = detail::NodeBytes<Heap<Key>, Key>::value;
+
+        // Constructor for empty heap, which keeps at most capacity keys
+        explicit BoundedHeap(size_t capacity, OverflowPolicy policy = OverflowPolicy::kEvict);
+
+        // Offers the key to the heap. Returns true, if the key is kept.
+        // When the heap is full, the key is rejected, or the boundary is evicted, if the key is greater than it.
+        bool Offer(Key key);
+
+        // Return the worst kept key, which is evicted first.
+        // Throws EmptyHeapException, if there is none
+        Key Boundary();
+
+        // Extracts the worst kept key.
+        // Throws EmptyHeapException, if there is none
+        void ExtractBoundary();
+
+        // Merges x into *this, the best Capacity() keys of the both heaps are kept. x becomes empty.
+        // Throws SelfHeapMergeException, if x is *this
+        void Merge(BoundedHeap &x);
+
+        // Extracts all the keys, the best one first. The heap becomes empty.
+        std::vector<Key> TakeBest();
+
+        // Return number of kept keys
+        size_t Size();
+
+        // Checks if the heap is empty
+        bool Empty();
+
+        // Maximal number of kept keys
+        size_t Capacity() const;
+
+        // Approximate memory taken by the heap and its nodes in bytes
+        size_t ByteUsage();
+
+    private:
+        Heap<Key> heap_;
+        size_t capacity_;
+        OverflowPolicy policy_;
+
+        // Moves the keys of the heap to the end of keys. The heap becomes empty.
+        static void Collect(Heap<Key> &heap, std::vector<Key> &keys);
+    };
+
+    template<class Key, template<class> class Heap>
+    BoundedHeap<Key, Heap>::BoundedHeap(size_t capacity, OverflowPolicy policy) : capacity_(capacity),
+                                                                                   policy_(policy) {}
+
+    template<class Key, template<class> class Heap>
+    bool BoundedHeap<Key, Heap>::Offer(Key key) {
+        if (heap_.Size() < capacity_) {
+            heap_.Insert(key);
+            return true;
+        }
+        if (policy_ == OverflowPolicy::kReject || capacity_ == 0 || !(heap_.GetMinimum() < key)) {
+            return false;
+        }
+        heap_.ExtractMinimum();
+        heap_.Insert(key);
+        return true;
+    }
+
+    template<class Key, template<class> class Heap>
+    Key BoundedHeap<Key, Heap>::Boundary() {
+        return heap_.GetMinimum();
+    }
+
+    template<class Key, template<class> class Heap>
+    void BoundedHeap<Key, Heap>::ExtractBoundary() {
+        heap_.ExtractMinimum();
+    }
+
+    template<class Key, template<class> class Heap>
+    void BoundedHeap<Key, Heap>::Collect(Heap<Key> &heap, std::vector<Key> &keys) {
+        if constexpr (detail::HasTakeKeys<Heap<Key>>::value) {
+            heap.TakeKeys([&keys](const Key &key) {
+                keys.push_back(key);
+            });
+        } else {
+            while (!heap.Empty()) {
+                keys.push_back(heap.GetMinimum());
+                heap.ExtractMinimum();
+            }
+        }
+    }
+
+    template<class Key, template<class> class Heap>
+    void BoundedHeap<Key, Heap>::Merge(BoundedHeap &x) {
+        if (&x == this) {
+            throw SelfHeapMergeException();
+        }
+        if (heap_.Size() + x.heap_.Size() <= capacity_) {
+            heap_.Merge(x.heap_);
+            return;
+        }
+        std::vector<Key> keys;
+        keys.reserve(heap_.Size() + x.heap_.Size());
+        Collect(heap_, keys);
+        Collect(x.heap_, keys);
+        // The best capacity_ keys are moved to the end.
+        auto first_kept = keys.end() - static_cast<std::ptrdiff_t>(capacity_);
+        std::nth_element(keys.begin(), first_kept, keys.end());
+        BulkBuilder<Heap<Key>> builder;
+        for (auto it = first_kept; it != keys.end(); ++it) {
+            builder.Add(*it);
+        }
+        heap_ = builder.Build();
+    }
+
+    template<class Key, template<class> class Heap>
+    std::vector<Key> BoundedHeap<Key, Heap>::TakeBest() {
+        std::vector<Key> keys;
+        keys.reserve(heap_.Size());
+        while (!heap_.Empty()) {
+            keys.push_back(heap_.GetMinimum());
+            heap_.ExtractMinimum();
+        }
+        std::reverse(keys.begin(), keys.end());
+        return keys;
+    }
+
+    template<class Key, template<class> class Heap>
+    size_t BoundedHeap<Key, Heap>::Size() {
+        return heap_.Size();
+    }
+
+    template<class Key, template<class> class Heap>
+    bool BoundedHeap<Key, Heap>::Empty() {
+        return heap_.Empty();
+    }
+
+    template<class Key, template<class> class Heap>
+    size_t BoundedHeap<Key, Heap>::Capacity() const {
+        return capacity_;
+    }
+
+    template<class Key, template<class> class Heap>
+    size_t BoundedHeap<Key, Heap>::ByteUsage() {
+        return sizeof(*this) + heap_.Size() * kBytesPerKey;
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_BOUNDED_H
@@ -0,0 +1,113 @@
+#ifndef MERGEABLE_HEAPS_CONVERSION_H
+#define MERGEABLE_HEAPS_CONVERSION_H
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace heaps {
+    namespace detail {
+        // Callback, which accepts any key
+        struct IgnoreKey {
+            template<class Key>
+            void operator()(const Key &) const {}
+        };
+
+        template<class Heap, class = void>
+        struct HasTakeKeys : std::false_type {};
+
+        template<class Heap>
+        struct HasTakeKeys<Heap, std::void_t<decltype(std::declval<Heap &>().TakeKeys(IgnoreKey()))>>
+                : std::true_type {};
+    } // namespace detail
+
+    // Builds a heap from the keys added one by one in O(n) total.
+    // The keys are kept as heaps of sizes 2^i, like the digits of a binary counter,
+    // adding a key melds the heaps of the equal size with a carry. Melds of the heaps of size 2^i
+    // cost O(i) for the leftist, skew and binomial heaps, which is O(1) amortized per key.
+    template<class Heap>
+    class BulkBuilder {
+    public:
+        template<class Key>
+        void Add(const Key &key);
+
+        // Melds the partial heaps from the smallest one. O(log^2 n)
+        // The builder becomes empty.
+        Heap Build();
+
+    private:
+        // slots_[i] holds 2^i keys, if occupied_[i] is set.
+        std::vector<Heap> slots_;
+        std::vector<bool> occupied_;
+    };
+
+    template<class Heap>
+    template<class Key>
+    void BulkBuilder<Heap>::Add(const Key &key) {
+        Heap carry;
+        carry.Insert(key);
+        size_t i = 0;
+        for (; i < slots_.size() && occupied_[i]; ++i) {
+            carry.Merge(slots_[i]);
+            occupied_[i] = false;
+        }
+        if (i == slots_.size()) {
+            slots_.emplace_back();
+            occupied_.push_back(false);
+        }
+        std::swap(slots_[i], carry);
+        occupied_[i] = true;
+    }
+
+    template<class Heap>
+    Heap BulkBuilder<Heap>::Build() {
+        Heap result;
+        for (size_t i = 0; i < slots_.size(); ++i) {
+            if (occupied_[i]) {
+                slots_[i].Merge(result);
+                std::swap(result, slots_[i]);
+            }
+        }
+        slots_.clear();
+        occupied_.clear();
+        return result;
+    }
+
+    // Moves all the keys of source into a new heap of type Target, source becomes empty.
+    // Heaps with TakeKeys (leftist, skew, binomial and blocked heaps) are walked without extraction
+    // and their nodes are freed on the way, so the peak memory stays about the size of one heap, O(n) in total.
+    // The other heaps are drained by ExtractMinimum, O(n log n).
+    template<class Target, class Source>
+    Target ConvertTo(Source &source) {
+        BulkBuilder<Target> builder;
+        if constexpr (detail::HasTakeKeys<Source>::value) {
+            source.TakeKeys([&builder](const auto &key) {
+                builder.Add(key);
+            });
+        } else {
+            while (!source.Empty()) {
+                builder.Add(source.GetMinimum());
+                source.ExtractMinimum();
+            }
+        }
+        return builder.Build();
+    }
+
+    // Merges source into target, the heaps may be of different types. Source becomes empty.
+    // Heaps of the same type are merged with Merge, otherwise source is converted with ConvertTo first.
+    template<class Target, class Source>
+    void MergeInto(Target &target, Source &source) {
+        if constexpr (std::is_same_v<Target, Source>) {
+            target.Merge(source);
+        } else {
+            Target converted = ConvertTo<Target>(source);
+            if (target.Empty()) {
+                std::swap(target, converted);
+            } else {
+                target.Merge(converted);
+            }
+        }
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_CONVERSION_H
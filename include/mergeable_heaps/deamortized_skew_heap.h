@@ -0,0 +1,422 @@
+#ifndef MERGEABLE_HEAPS_DEAMORTIZED_SKEW_H
+#define MERGEABLE_HEAPS_DEAMORTIZED_SKEW_H
+
+#include <vector>
+#include <algorithm>
+#include "heap_interface.h"
+#include "exceptions.h"
+#include "nodes/skew_heap_node.h"
+
+namespace heaps {
+    // Skew Heap with bounded work per operation. Key is the type of data stored
+    // The heap is a short list of pieces: complete skew trees and merges in progress.
+    // A merge is the top-down skew merge of two trees, which is advanced by at most MaxSteps nodes
+    // per operation and continued by the next ones. Nodes placed by a merge are already in heap order,
+    // so the minimum is known at all times: it's the smallest root of the pieces.
+    // Every operation does at most MaxSteps merge steps and scans the pieces. MaxSteps must exceed
+    // the amortized cost of the skew merge, about 3 log2 n steps, otherwise the unfinished merges pile up.
+    template<class Key, size_t MaxSteps = 64>
+    class DeamortizedSkewHeap : public HeapInterface<Key> {
+    private:
+        using Node = SkewHeapNode<Key>;
+
+        // Complete tree, if input_1_ and input_2_ are nullptr. Otherwise a merge in progress:
+        // output_ is the merged part, where every placed node is the left child of the previous one,
+        // and the rest of input_1_ and input_2_ goes to the left child of tail_.
+        struct Piece {
+            Node *output_;
+            Node *tail_;
+            Node *input_1_;
+            Node *input_2_;
+
+            bool InProgress() const;
+
+            // Root of the piece with the minimal key
+            Node *Top() const;
+
+            // Places the smaller root of the inputs. Returns true, if the merge is complete.
+            bool Step();
+        };
+
+        std::vector<Piece> pieces_;
+        // Number of items in the heap
+        size_t size_;
+        // Number of merge steps done by Work
+        size_t steps_;
+
+        // Index of the piece with the minimal key
+        size_t TopPiece() const;
+
+        // Advances the merges in progress and starts new ones for the complete trees,
+        // until MaxSteps nodes are placed or there is one complete tree left.
+        void Work();
+
+        // Deletes all the nodes
+        void Clear();
+
+    public:
+        // Constructor for empty heap
+        DeamortizedSkewHeap();
+
+        // Constructor for one-item heap
+        explicit DeamortizedSkewHeap(Key key);
+
+        // Inserts an item into the heap
+        void Insert(Key x) override;
+
+        // Return the minimal item in heap. O(number of pieces)
+        // Throws EmptyHeapException, if there is none
+        Key GetMinimum() override;
+
+        // Extracts minimal item from the heap
+        // Throws EmptyHeapException, if there is none
+        void ExtractMinimum() override;
+
+        // Merges an abstract heap into *this. The pieces are only moved, the merge is continued later.
+        // Throws WrongHeapTypeException, if x is not a DeamortizedSkewHeap
+        void Merge(HeapInterface<Key> &x) override;
+
+        // Return number of items in the heap
+        size_t Size() override;
+
+        // Checks if the heap is empty
+        bool Empty() override;
+
+        // Detaches heap from its nodes without deleting them
+        // Now, it's user's responsibility to free node's memory.
+        void Detach() override;
+
+        // Completes all the merges in progress, the heap becomes one skew tree.
+        void Flush();
+
+        // Number of complete trees and merges in progress
+        size_t PiecesCount() const;
+
+        // Number of merges in progress
+        size_t MergesInProgress() const;
+
+        // Number of merge steps done so far. Every operation but Flush adds at most MaxSteps.
+        size_t StepsCount() const;
+
+        // Returns sorted std::vector with all the keys from the heap.
+        // Mainly for debug purposes.
+        std::vector<Key> Data();
+
+        //
+        // Rule of Five functions
+        //
+
+        // Destructor. Destructs the heap with all it's nodes
+        ~DeamortizedSkewHeap();
+
+        // Copy constructor. Creates the copy of the heap and all it's nodes
+        DeamortizedSkewHeap(const DeamortizedSkewHeap &other);
+
+        // Move constructor. Creates the copy of the heap by stealing resources.
+        // Other heap is left as newly initialized.
+        DeamortizedSkewHeap(DeamortizedSkewHeap &&other) noexcept;
+
+        // Copy assignment operator
+        DeamortizedSkewHeap &operator=(const DeamortizedSkewHeap &other);
+
+        // Move assignment operator
+        DeamortizedSkewHeap &operator=(DeamortizedSkewHeap &&other) noexcept;
+
+        // Swap function for "Copy and Swap" idiom
+        void Swap(DeamortizedSkewHeap &x) noexcept;
+    };
+
+    template<class Key, size_t MaxSteps>
+    bool DeamortizedSkewHeap<Key, MaxSteps>::Piece::InProgress() const {
+        return input_1_ != nullptr;
+    }
+
+    template<class Key, size_t MaxSteps>
+    typename DeamortizedSkewHeap<Key, MaxSteps>::Node *DeamortizedSkewHeap<Key, MaxSteps>::Piece::Top() const {
+        if (output_ != nullptr || !InProgress()) {
+            return output_;
+        }
+        return input_2_->key_ < input_1_->key_ ? input_2_ : input_1_;
+    }
+
+    template<class Key, size_t MaxSteps>
+    bool DeamortizedSkewHeap<Key, MaxSteps>::Piece::Step() {
+        if (!(input_1_->key_ < input_2_->key_)) {
+            std::swap(input_1_, input_2_);
+        }
+        // Same as SkewHeapNode::Merge_: children of the placed root are swapped,
+        // its right path is merged with the other input into the left child.
+        Node *v = input_1_;
+        v->PushDown();
+        (tail_ == nullptr ? output_ : tail_->child_left_) = v;
+        tail_ = v;
+        input_1_ = v->child_right_;
+        v->child_right_ = v->child_left_;
+        v->child_left_ = nullptr;
+        if (input_1_ == nullptr) {
+            v->child_left_ = input_2_;
+            input_2_ = nullptr;
+            tail_ = nullptr;
+            return true;
+        }
+        return false;
+    }
+
+    template<class Key, size_t MaxSteps>
+    DeamortizedSkewHeap<Key, MaxSteps>::DeamortizedSkewHeap() : size_(0), steps_(0) {}
+
+    template<class Key, size_t MaxSteps>
+    DeamortizedSkewHeap<Key, MaxSteps>::DeamortizedSkewHeap(Key key) : DeamortizedSkewHeap() {
+        Insert(key);
+    }
+
+    template<class Key, size_t MaxSteps>
+    size_t DeamortizedSkewHeap<Key, MaxSteps>::TopPiece() const {
+        size_t top = 0;
+        for (size_t i = 1; i < pieces_.size(); ++i) {
+            if (pieces_[i].Top()->key_ < pieces_[top].Top()->key_) {
+                top = i;
+            }
+        }
+        return top;
+    }
+
+    template<class Key, size_t MaxSteps>
+    void DeamortizedSkewHeap<Key, MaxSteps>::Work() {
+        size_t steps = 0;
+        size_t i = 0;
+        while (steps < MaxSteps && i < pieces_.size()) {
+            if (pieces_[i].InProgress()) {
+                while (steps < MaxSteps) {
+                    ++steps;
+                    if (pieces_[i].Step()) {
+                        break;
+                    }
+                }
+                if (pieces_[i].InProgress()) {
+                    steps_ += steps;
+                    return;
+                }
+            }
+            ++i;
+        }
+        // Merges the last two complete trees.
+        while (steps < MaxSteps && pieces_.size() > 1) {
+            Piece &first = pieces_[pieces_.size() - 2];
+            Piece &second = pieces_.back();
+            if (first.InProgress() || second.InProgress()) {
+                steps_ += steps;
+                return;
+            }
+            first = Piece{nullptr, nullptr, first.output_, second.output_};
+            pieces_.pop_back();
+            while (steps < MaxSteps) {
+                ++steps;
+                if (first.Step()) {
+                    break;
+                }
+            }
+        }
+        steps_ += steps;
+    }
+
+    template<class Key, size_t MaxSteps>
+    void DeamortizedSkewHeap<Key, MaxSteps>::Insert(Key x) {
+        auto *v = new Node();
+        v->key_ = x;
+        pieces_.push_back(Piece{v, nullptr, nullptr, nullptr});
+        ++size_;
+        Work();
+    }
+
+    template<class Key, size_t MaxSteps>
+    Key DeamortizedSkewHeap<Key, MaxSteps>::GetMinimum() {
+        if (Empty()) {
+            throw EmptyHeapException();
+        }
+        return pieces_[TopPiece()].Top()->key_;
+    }
+
+    template<class Key, size_t MaxSteps>
+    void DeamortizedSkewHeap<Key, MaxSteps>::ExtractMinimum() {
+        if (Empty()) {
+            throw EmptyHeapException();
+        }
+        Piece &piece = pieces_[TopPiece()];
+        if (piece.output_ == nullptr) {
+            // The minimum is a root of the inputs, it's placed first.
+            piece.Step();
+        }
+        Node *root = piece.output_;
+        root->PushDown();
+        Node *left = root->child_left_;
+        Node *right = root->child_right_;
+        if (piece.tail_ == root) {
+            // The merge continues into the empty output.
+            piece.output_ = piece.tail_ = nullptr;
+        } else {
+            piece.output_ = left;
+        }
+        root->Detach();
+        delete root;
+        if (piece.output_ == nullptr && !piece.InProgress()) {
+            piece = pieces_.back();
+            pieces_.pop_back();
+        }
+        if (right != nullptr) {
+            pieces_.push_back(Piece{right, nullptr, nullptr, nullptr});
+        }
+        --size_;
+        Work();
+    }
+
+    template<class Key, size_t MaxSteps>
+    void DeamortizedSkewHeap<Key, MaxSteps>::Merge(HeapInterface<Key> &x) {
+        if (&x == this) {
+            throw SelfHeapMergeException();
+        }
+        try {
+            auto &casted = dynamic_cast<DeamortizedSkewHeap<Key, MaxSteps> &>(x);
+            pieces_.insert(pieces_.end(), casted.pieces_.begin(), casted.pieces_.end());
+            size_ += casted.size_;
+            x.Detach();
+            Work();
+        } catch (const std::bad_cast &e) {
+            throw WrongHeapTypeException();
+        }
+    }
+
+    template<class Key, size_t MaxSteps>
+    size_t DeamortizedSkewHeap<Key, MaxSteps>::Size() {
+        return size_;
+    }
+
+    template<class Key, size_t MaxSteps>
+    bool DeamortizedSkewHeap<Key, MaxSteps>::Empty() {
+        return size_ == 0;
+    }
+
+    template<class Key, size_t MaxSteps>
+    void DeamortizedSkewHeap<Key, MaxSteps>::Detach() {
+        pieces_.clear();
+        size_ = 0;
+    }
+
+    template<class Key, size_t MaxSteps>
+    void DeamortizedSkewHeap<Key, MaxSteps>::Flush() {
+        while (pieces_.size() > 1 || (pieces_.size() == 1 && pieces_[0].InProgress())) {
+            Work();
+        }
+    }
+
+    template<class Key, size_t MaxSteps>
+    size_t DeamortizedSkewHeap<Key, MaxSteps>::PiecesCount() const {
+        return pieces_.size();
+    }
+
+    template<class Key, size_t MaxSteps>
+    size_t DeamortizedSkewHeap<Key, MaxSteps>::MergesInProgress() const {
+        return static_cast<size_t>(std::count_if(pieces_.begin(), pieces_.end(), [](const Piece &piece) {
+            return piece.InProgress();
+        }));
+    }
+
+    template<class Key, size_t MaxSteps>
+    size_t DeamortizedSkewHeap<Key, MaxSteps>::StepsCount() const {
+        return steps_;
+    }
+
+    template<class Key, size_t MaxSteps>
+    std::vector<Key> DeamortizedSkewHeap<Key, MaxSteps>::Data() {
+        std::vector<Key> data;
+        data.reserve(size_);
+        std::vector<Node *> stack;
+        for (const auto &piece: pieces_) {
+            for (Node *v: {piece.output_, piece.input_1_, piece.input_2_}) {
+                if (v != nullptr) {
+                    stack.push_back(v);
+                }
+            }
+        }
+        while (!stack.empty()) {
+            Node *v = stack.back();
+            stack.pop_back();
+            data.push_back(v->key_);
+            v->PushDown();
+            for (Node *child: {v->child_left_, v->child_right_}) {
+                if (child != nullptr) {
+                    stack.push_back(child);
+                }
+            }
+        }
+        std::sort(data.begin(), data.end());
+        return data;
+    }
+
+    template<class Key, size_t MaxSteps>
+    void DeamortizedSkewHeap<Key, MaxSteps>::Clear() {
+        for (const auto &piece: pieces_) {
+            delete piece.output_;
+            delete piece.input_1_;
+            delete piece.input_2_;
+        }
+        Detach();
+    }
+
+    // Destructor
+    template<class Key, size_t MaxSteps>
+    DeamortizedSkewHeap<Key, MaxSteps>::~DeamortizedSkewHeap() {
+        Clear();
+    }
+
+    // Copy constructor
+    template<class Key, size_t MaxSteps>
+    DeamortizedSkewHeap<Key, MaxSteps>::DeamortizedSkewHeap(const DeamortizedSkewHeap &other) : size_(other.size_), steps_(other.steps_) {
+        pieces_.reserve(other.pieces_.size());
+        auto copy = [](Node *v) {
+            return v == nullptr ? nullptr : new Node(*v);
+        };
+        for (const auto &piece: other.pieces_) {
+            Piece copied{copy(piece.output_), nullptr, copy(piece.input_1_), copy(piece.input_2_)};
+            // The placed nodes are the left path of the output.
+            if (piece.tail_ != nullptr) {
+                copied.tail_ = copied.output_;
+                while (copied.tail_->child_left_ != nullptr) {
+                    copied.tail_ = copied.tail_->child_left_;
+                }
+            }
+            pieces_.push_back(copied);
+        }
+    }
+
+    // Move constructor
+    template<class Key, size_t MaxSteps>
+    DeamortizedSkewHeap<Key, MaxSteps>::DeamortizedSkewHeap(DeamortizedSkewHeap &&other) noexcept : DeamortizedSkewHeap() {
+        Swap(other);
+    }
+
+    // Copy assignment operator
+    template<class Key, size_t MaxSteps>
+    DeamortizedSkewHeap<Key, MaxSteps> &DeamortizedSkewHeap<Key, MaxSteps>::operator=(const DeamortizedSkewHeap &other) {
+        DeamortizedSkewHeap tmp(other);
+        Swap(tmp);
+        return *this;
+    }
+
+    // Move assignment operator
+    template<class Key, size_t MaxSteps>
+    DeamortizedSkewHeap<Key, MaxSteps> &DeamortizedSkewHeap<Key, MaxSteps>::operator=(DeamortizedSkewHeap &&other) noexcept {
+        DeamortizedSkewHeap tmp(std::move(other));
+        Swap(tmp);
+        return *this;
+    }
+
+    template<class Key, size_t MaxSteps>
+    void DeamortizedSkewHeap<Key, MaxSteps>::Swap(DeamortizedSkewHeap &x) noexcept {
+        std::swap(pieces_, x.pieces_);
+        std::swap(size_, x.size_);
+        std::swap(steps_, x.steps_);
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_DEAMORTIZED_SKEW_H
@@ -0,0 +1,283 @@
+#ifndef MERGEABLE_HEAPS_DOUBLE_ENDED_H
+#define MERGEABLE_HEAPS_DOUBLE_ENDED_H
+
+#include <array>
+#include <vector>
+#include <algorithm>
+#include "heap_interface.h"
+#include "exceptions.h"
+#include "nodes/double_ended_heap_node.h"
+
+namespace heaps {
+    // Double-Ended Heap implementation. Key is the type of data stored.
+    // Every key is stored in one node, which belongs to a min-ordered and a max-ordered leftist tree,
+    // the trees have parent links, so the node extracted from one of them is removed from the other one.
+    // GetMinimum and GetMaximum are O(1), Insert, ExtractMinimum, ExtractMaximum and Merge are O(log n).
+    template<class Key>
+    class DoubleEndedHeap : public HeapInterface<Key> {
+    private:
+        using Node = DoubleEndedHeapNode<Key>;
+
+        // Roots of the min-ordered and the max-ordered trees. Equal to nullptr, if the heap is empty.
+        std::array<Node *, 2> roots_;
+        // Number of items in the heap
+        size_t size_;
+
+        // Removes the root of the given side from both trees.
+        template<size_t Side>
+        void Extract();
+
+        // Deletes all the nodes
+        void Clear();
+
+    public:
+        // Constructor for empty heap
+        DoubleEndedHeap();
+
+        // Constructor for one-item heap
+        explicit DoubleEndedHeap(Key key);
+
+        // Inserts an item into the heap
+        void Insert(Key x) override;
+
+        // Return the minimal item in heap. O(1)
+        // Throws EmptyHeapException, if there is none
+        Key GetMinimum() override;
+
+        // Return the maximal item in heap. O(1)
+        // Throws EmptyHeapException, if there is none
+        Key GetMaximum();
+
+        // Extracts minimal item from the heap
+        // Throws EmptyHeapException, if there is none
+        void ExtractMinimum() override;
+
+        // Extracts maximal item from the heap
+        // Throws EmptyHeapException, if there is none
+        void ExtractMaximum();
+
+        // Merges an abstract heap into *this
+        // Throws WrongHeapTypeException, if x is not a DoubleEndedHeap
+        void Merge(HeapInterface<Key> &x) override;
+
+        // Return number of items in the heap
+        size_t Size() override;
+
+        // Checks if the heap is empty
+        bool Empty() override;
+
+        // Detaches heap from its nodes without deleting them
+        // Now, it's user's responsibility to free node's memory.
+        void Detach() override;
+
+        // Returns sorted std::vector with all the keys from the heap.
+        // Mainly for debug purposes.
+        std::vector<Key> Data();
+
+        //
+        // Rule of Five functions
+        //
+
+        // Destructor. Destructs the heap with all it's nodes
+        ~DoubleEndedHeap();
+
+        // Copy constructor. Inserts the keys of the other heap one by one, O(n log n).
+        DoubleEndedHeap(const DoubleEndedHeap &other);
+
+        // Move constructor. Creates the copy of the heap by stealing resources.
+        // Other heap is left as newly initialized.
+        DoubleEndedHeap(DoubleEndedHeap &&other) noexcept;
+
+        // Copy assignment operator
+        DoubleEndedHeap &operator=(const DoubleEndedHeap &other);
+
+        // Move assignment operator
+        DoubleEndedHeap &operator=(DoubleEndedHeap &&other) noexcept;
+
+        // Swap function for "Copy and Swap" idiom
+        void Swap(DoubleEndedHeap &x) noexcept;
+    };
+
+    template<class Key>
+    DoubleEndedHeap<Key>::DoubleEndedHeap() : roots_{nullptr, nullptr}, size_(0) {}
+
+    template<class Key>
+    DoubleEndedHeap<Key>::DoubleEndedHeap(Key key) : DoubleEndedHeap() {
+        Insert(key);
+    }
+
+    template<class Key>
+    void DoubleEndedHeap<Key>::Insert(Key x) {
+        auto *v = new Node(x);
+        roots_[Node::kMin] = Node::template Merge_<Node::kMin>(roots_[Node::kMin], v);
+        roots_[Node::kMax] = Node::template Merge_<Node::kMax>(roots_[Node::kMax], v);
+        ++size_;
+    }
+
+    template<class Key>
+    Key DoubleEndedHeap<Key>::GetMinimum() {
+        if (Empty()) {
+            throw EmptyHeapException();
+        }
+        return roots_[Node::kMin]->key_;
+    }
+
+    template<class Key>
+    Key DoubleEndedHeap<Key>::GetMaximum() {
+        if (Empty()) {
+            throw EmptyHeapException();
+        }
+        return roots_[Node::kMax]->key_;
+    }
+
+    template<class Key>
+    template<size_t Side>
+    void DoubleEndedHeap<Key>::Extract() {
+        if (Empty()) {
+            throw EmptyHeapException();
+        }
+        Node *v = roots_[Side];
+        roots_[Node::kMin] = Node::template Remove<Node::kMin>(roots_[Node::kMin], v);
+        roots_[Node::kMax] = Node::template Remove<Node::kMax>(roots_[Node::kMax], v);
+        delete v;
+        --size_;
+    }
+
+    template<class Key>
+    void DoubleEndedHeap<Key>::ExtractMinimum() {
+        Extract<Node::kMin>();
+    }
+
+    template<class Key>
+    void DoubleEndedHeap<Key>::ExtractMaximum() {
+        Extract<Node::kMax>();
+    }
+
+    template<class Key>
+    void DoubleEndedHeap<Key>::Merge(HeapInterface<Key> &x) {
+        if (&x == this) {
+            throw SelfHeapMergeException();
+        }
+        try {
+            auto &casted = dynamic_cast<DoubleEndedHeap<Key> &>(x);
+            roots_[Node::kMin] = Node::template Merge_<Node::kMin>(roots_[Node::kMin], casted.roots_[Node::kMin]);
+            roots_[Node::kMax] = Node::template Merge_<Node::kMax>(roots_[Node::kMax], casted.roots_[Node::kMax]);
+            size_ += casted.size_;
+            x.Detach();
+        } catch (const std::bad_cast &e) {
+            throw WrongHeapTypeException();
+        }
+    }
+
+    template<class Key>
+    size_t DoubleEndedHeap<Key>::Size() {
+        return size_;
+    }
+
+    template<class Key>
+    bool DoubleEndedHeap<Key>::Empty() {
+        return size_ == 0;
+    }
+
+    template<class Key>
+    void DoubleEndedHeap<Key>::Detach() {
+        roots_ = {nullptr, nullptr};
+        size_ = 0;
+    }
+
+    template<class Key>
+    std::vector<Key> DoubleEndedHeap<Key>::Data() {
+        std::vector<Key> data;
+        data.reserve(size_);
+        std::vector<Node *> stack;
+        if (roots_[Node::kMin] != nullptr) {
+            stack.push_back(roots_[Node::kMin]);
+        }
+        while (!stack.empty()) {
+            Node *v = stack.back();
+            stack.pop_back();
+            data.push_back(v->key_);
+            for (Node *child: {v->links_[Node::kMin].child_left_, v->links_[Node::kMin].child_right_}) {
+                if (child != nullptr) {
+                    stack.push_back(child);
+                }
+            }
+        }
+        std::sort(data.begin(), data.end());
+        return data;
+    }
+
+    template<class Key>
+    void DoubleEndedHeap<Key>::Clear() {
+        std::vector<Node *> stack;
+        if (roots_[Node::kMin] != nullptr) {
+            stack.push_back(roots_[Node::kMin]);
+        }
+        while (!stack.empty()) {
+            Node *v = stack.back();
+            stack.pop_back();
+            for (Node *child: {v->links_[Node::kMin].child_left_, v->links_[Node::kMin].child_right_}) {
+                if (child != nullptr) {
+                    stack.push_back(child);
+                }
+            }
+            delete v;
+        }
+        Detach();
+    }
+
+    // Destructor
+    template<class Key>
+    DoubleEndedHeap<Key>::~DoubleEndedHeap() {
+        Clear();
+    }
+
+    // Copy constructor
+    template<class Key>
+    DoubleEndedHeap<Key>::DoubleEndedHeap(const DoubleEndedHeap &other) : DoubleEndedHeap() {
+        std::vector<Node *> stack;
+        if (other.roots_[Node::kMin] != nullptr) {
+            stack.push_back(other.roots_[Node::kMin]);
+        }
+        while (!stack.empty()) {
+            Node *v = stack.back();
+            stack.pop_back();
+            Insert(v->key_);
+            for (Node *child: {v->links_[Node::kMin].child_left_, v->links_[Node::kMin].child_right_}) {
+                if (child != nullptr) {
+                    stack.push_back(child);
+                }
+            }
+        }
+    }
+
+    // Move constructor
+    template<class Key>
+    DoubleEndedHeap<Key>::DoubleEndedHeap(DoubleEndedHeap &&other) noexcept : DoubleEndedHeap() {
+        Swap(other);
+    }
+
+    // Copy assignment operator
+    template<class Key>
+    DoubleEndedHeap<Key> &DoubleEndedHeap<Key>::operator=(const DoubleEndedHeap &other) {
+        DoubleEndedHeap tmp(other);
+        Swap(tmp);
+        return *this;
+    }
+
+    // Move assignment operator
+    template<class Key>
+    DoubleEndedHeap<Key> &DoubleEndedHeap<Key>::operator=(DoubleEndedHeap &&other) noexcept {
+        DoubleEndedHeap tmp(std::move(other));
+        Swap(tmp);
+        return *this;
+    }
+
+    template<class Key>
+    void DoubleEndedHeap<Key>::Swap(DoubleEndedHeap &x) noexcept {
+        std::swap(roots_, x.roots_);
+        std::swap(size_, x.size_);
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_DOUBLE_ENDED_H
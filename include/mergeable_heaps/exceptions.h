@@ -1,6 +1,9 @@
 #ifndef MERGEABLE_HEAPS_EXCEPTIONS_H
 #define MERGEABLE_HEAPS_EXCEPTIONS_H
 
+#include <exception>
+#include <typeinfo>
+
 namespace heaps {
     class WrongHeapTypeException : public std::exception {
         [[nodiscard]] const char *what() const noexcept override {
@@ -25,6 +28,36 @@ namespace heaps {
             return "This method is restricted, because the result can't be relied on.";
         }
     };
+
+    class NoArborescenceException : public std::exception {
+        [[nodiscard]] const char *what() const noexcept override {
+            return "Some vertices are not reachable from the root, there is no arborescence";
+        }
+    };
+
+    class ClosedChannelException : public std::exception {
+        [[nodiscard]] const char *what() const noexcept override {
+            return "Can't push into a closed channel";
+        }
+    };
+
+    class SharedHeapFullException : public std::exception {
+        [[nodiscard]] const char *what() const noexcept override {
+            return "The shared memory segment has no free nodes";
+        }
+    };
+
+    class SharedHeapLayoutException : public std::exception {
+        [[nodiscard]] const char *what() const noexcept override {
+            return "The shared memory segment holds no heap of this type";
+        }
+    };
+
+    class CorruptedSharedHeapException : public std::exception {
+        [[nodiscard]] const char *what() const noexcept override {
+            return "A process died in the middle of an operation, the shared heaps are inconsistent";
+        }
+    };
 } // namespace heaps
 
 #endif // MERGEABLE_HEAPS_EXCEPTIONS_H
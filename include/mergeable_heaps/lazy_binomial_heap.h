@@ -0,0 +1,320 @@
+#ifndef MERGEABLE_HEAPS_LAZY_BINOMIAL_H
+#define MERGEABLE_HEAPS_LAZY_BINOMIAL_H
+
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include "heap_interface.h"
+#include "exceptions.h"
+#include "nodes/binomial_heap_node.h"
+
+namespace heaps {
+    // Lazy Binomial Heap implementation. Key is the type of data stored.
+    // Insert and Merge only splice trees onto the list of roots in O(1),
+    // trees of the same degree are consolidated during ExtractMinimum.
+    // Insert and Merge are O(1), ExtractMinimum is amortized O(log n).
+    template<class Key>
+    class LazyBinomialHeap : public HeapInterface<Key> {
+    private:
+        // Degree of a tree can't exceed the number of bits in size_t.
+        static constexpr size_t kMaxDegree = 64;
+
+        // List of roots, linked by sibling_. Degrees are in no particular order.
+        BinomialHeapNode<Key> *head_;
+        BinomialHeapNode<Key> *tail_;
+        // The root with the minimal key. If there is none, nullptr.
+        BinomialHeapNode<Key> *minimal_;
+        // Number of items in the heap
+        size_t size_;
+
+        // Links two trees of the same degree. The one with the smaller key becomes the root.
+        static BinomialHeapNode<Key> *Link(BinomialHeapNode<Key> *v1, BinomialHeapNode<Key> *v2);
+
+        // Appends the tree to the end of the list of roots and updates minimal_.
+        void PushRoot(BinomialHeapNode<Key> *v);
+
+        // Deletes all the nodes. Roots are deleted one by one,
+        // as the list of roots may be too long for the recursive destructor.
+        void Clear();
+
+    public:
+        // Size of one node of the trees in bytes
+        static constexpr size_t kNodeBytes = sizeof(BinomialHeapNode<Key>);
+
+        // Constructor for empty heap
+        LazyBinomialHeap();
+
+        // Constructor for one-item heap
+        explicit LazyBinomialHeap(Key key);
+
+        // Inserts an item into the heap. O(1)
+        void Insert(Key x) override;
+
+        // Return the minimal item in heap. O(1)
+        // Throws EmptyHeapException, if there is none
+        Key GetMinimum() override;
+
+        // Extracts minimal item from the heap and consolidates the roots.
+        // Throws EmptyHeapException, if there is none
+        void ExtractMinimum() override;
+
+        // Merges an abstract heap into *this. O(1)
+        // Throws WrongHeapTypeException, if x is not a LazyBinomialHeap
+        void Merge(HeapInterface<Key> &x) override;
+
+        // Return number of items in the heap
+        size_t Size() override;
+
+        // Checks if the heap is empty
+        bool Empty() override;
+
+        // Detaches heap from its nodes without deleting them
+        // Now, it's user's responsibility to free node's memory.
+        void Detach() override;
+
+        // Passes all the keys to callback in no particular order and deletes the nodes on the way.
+        // The heap becomes empty. O(n)
+        template<class Callback>
+        void TakeKeys(Callback &&callback);
+
+        // Returns sorted std::vector with all the keys from the heap.
+        // Mainly for debug purposes.
+        std::vector<Key> Data();
+
+        //
+        // Rule of Five functions
+        //
+
+        // Destructor. Destructs the heap with all it's nodes
+        // Unless they are detached.
+        ~LazyBinomialHeap();
+
+        // Copy constructor. Creates the copy of the heap and all it's nodes
+        LazyBinomialHeap(const LazyBinomialHeap<Key> &other);
+
+        // Move constructor. Creates the copy of the heap by stealing resources.
+        // Other heap is left as newly initialized.
+        LazyBinomialHeap(LazyBinomialHeap<Key> &&other) noexcept;
+
+        // Copy assignment operator
+        LazyBinomialHeap<Key> &operator=(const LazyBinomialHeap<Key> &other);
+
+        // Move assignment operator
+        LazyBinomialHeap<Key> &operator=(LazyBinomialHeap<Key> &&other) noexcept;
+
+        // Swap function for "Copy and Swap" idiom
+        void Swap(LazyBinomialHeap<Key> &x) noexcept;
+    };
+
+    template<class Key>
+    LazyBinomialHeap<Key>::LazyBinomialHeap() : head_(nullptr), tail_(nullptr), minimal_(nullptr), size_(0) {}
+
+    template<class Key>
+    LazyBinomialHeap<Key>::LazyBinomialHeap(Key key) : LazyBinomialHeap() {
+        Insert(key);
+    }
+
+    template<class Key>
+    BinomialHeapNode<Key> *LazyBinomialHeap<Key>::Link(BinomialHeapNode<Key> *v1, BinomialHeapNode<Key> *v2) {
+        if (v2->key_ < v1->key_) {
+            std::swap(v1, v2);
+        }
+        v1->Merge_(v2);
+        return v1;
+    }
+
+    template<class Key>
+    void LazyBinomialHeap<Key>::PushRoot(BinomialHeapNode<Key> *v) {
+        v->sibling_ = nullptr;
+        v->parent_ = nullptr;
+        if (head_ == nullptr) {
+            head_ = v;
+        } else {
+            tail_->sibling_ = v;
+        }
+        tail_ = v;
+        if (minimal_ == nullptr || v->key_ < minimal_->key_) {
+            minimal_ = v;
+        }
+    }
+
+    template<class Key>
+    void LazyBinomialHeap<Key>::Insert(Key x) {
+        PushRoot(new BinomialHeapNode<Key>(x, nullptr, nullptr, nullptr, 0u));
+        ++size_;
+    }
+
+    template<class Key>
+    Key LazyBinomialHeap<Key>::GetMinimum() {
+        if (Empty()) {
+            throw EmptyHeapException();
+        }
+        return minimal_->key_;
+    }
+
+    template<class Key>
+    void LazyBinomialHeap<Key>::ExtractMinimum() {
+        if (Empty()) {
+            throw EmptyHeapException();
+        }
+        // buckets[i] is the only tree of degree i found so far.
+        std::array<BinomialHeapNode<Key> *, kMaxDegree> buckets;
+        uint64_t occupied = 0;
+        auto consolidate = [&](BinomialHeapNode<Key> *v) {
+            v->sibling_ = nullptr;
+            v->parent_ = nullptr;
+            while (occupied >> v->degree_ & 1u) {
+                occupied &= ~(uint64_t(1) << v->degree_);
+                v = Link(buckets[v->degree_], v);
+            }
+            buckets[v->degree_] = v;
+            occupied |= uint64_t(1) << v->degree_;
+        };
+
+        for (BinomialHeapNode<Key> *i = head_; i != nullptr;) {
+            BinomialHeapNode<Key> *next = i->sibling_;
+            if (i != minimal_) {
+                consolidate(i);
+            }
+            i = next;
+        }
+        for (BinomialHeapNode<Key> *i = minimal_->child_; i != nullptr;) {
+            BinomialHeapNode<Key> *next = i->sibling_;
+            consolidate(i);
+            i = next;
+        }
+        minimal_->Detach();
+        delete minimal_;
+
+        head_ = tail_ = minimal_ = nullptr;
+        for (uint64_t bits = occupied; bits != 0; bits &= bits - 1) {
+            PushRoot(buckets[__builtin_ctzll(bits)]);
+        }
+        --size_;
+    }
+
+    template<class Key>
+    void LazyBinomialHeap<Key>::Merge(HeapInterface<Key> &x) {
+        if (&x == this) {
+            throw SelfHeapMergeException();
+        }
+        try {
+            auto &casted = dynamic_cast<LazyBinomialHeap<Key> &>(x);
+            if (casted.head_ != nullptr) {
+                if (head_ == nullptr) {
+                    head_ = casted.head_;
+                } else {
+                    tail_->sibling_ = casted.head_;
+                }
+                tail_ = casted.tail_;
+                if (minimal_ == nullptr || casted.minimal_->key_ < minimal_->key_) {
+                    minimal_ = casted.minimal_;
+                }
+            }
+            size_ += casted.size_;
+            x.Detach();
+        } catch (const std::bad_cast &e) {
+            throw WrongHeapTypeException();
+        }
+    }
+
+    template<class Key>
+    size_t LazyBinomialHeap<Key>::Size() {
+        return size_;
+    }
+
+    template<class Key>
+    bool LazyBinomialHeap<Key>::Empty() {
+        return size_ == 0;
+    }
+
+    template<class Key>
+    void LazyBinomialHeap<Key>::Detach() {
+        head_ = tail_ = minimal_ = nullptr;
+        size_ = 0;
+    }
+
+    template<class Key>
+    template<class Callback>
+    void LazyBinomialHeap<Key>::TakeKeys(Callback &&callback) {
+        BinomialHeapNode<Key>::TakeKeys(head_, callback);
+        Detach();
+    }
+
+    template<class Key>
+    std::vector<Key> LazyBinomialHeap<Key>::Data() {
+        std::vector<Key> data;
+        for (BinomialHeapNode<Key> *i = head_; i != nullptr; i = i->sibling_) {
+            data.push_back(i->key_);
+            if (i->child_ != nullptr) {
+                i->child_->CollectData(data);
+            }
+        }
+        std::sort(data.begin(), data.end());
+        return data;
+    }
+
+    template<class Key>
+    void LazyBinomialHeap<Key>::Clear() {
+        for (BinomialHeapNode<Key> *i = head_; i != nullptr;) {
+            BinomialHeapNode<Key> *next = i->sibling_;
+            i->sibling_ = nullptr;
+            delete i;
+            i = next;
+        }
+        Detach();
+    }
+
+    // Destructor
+    template<class Key>
+    LazyBinomialHeap<Key>::~LazyBinomialHeap() {
+        Clear();
+    }
+
+    // Copy constructor
+    template<class Key>
+    LazyBinomialHeap<Key>::LazyBinomialHeap(const LazyBinomialHeap<Key> &other) : LazyBinomialHeap() {
+        for (BinomialHeapNode<Key> *i = other.head_; i != nullptr; i = i->sibling_) {
+            BinomialHeapNode<Key> *child = i->child_ == nullptr ? nullptr : new BinomialHeapNode<Key>(*i->child_);
+            PushRoot(new BinomialHeapNode<Key>(i->key_, nullptr, nullptr, child, i->degree_));
+        }
+        size_ = other.size_;
+    }
+
+    // Move constructor
+    template<class Key>
+    LazyBinomialHeap<Key>::LazyBinomialHeap(LazyBinomialHeap<Key> &&other) noexcept : LazyBinomialHeap() {
+        Swap(other);
+    }
+
+    // Copy assignment operator
+    template<class Key>
+    LazyBinomialHeap<Key> &LazyBinomialHeap<Key>::operator=(const LazyBinomialHeap<Key> &other) {
+        if (this != &other) {
+            LazyBinomialHeap tmp(other);
+            Swap(tmp);
+        }
+        return *this;
+    }
+
+    // Move assignment operator
+    template<class Key>
+    LazyBinomialHeap<Key> &LazyBinomialHeap<Key>::operator=(LazyBinomialHeap<Key> &&other) noexcept {
+        if (this != &other) {
+            LazyBinomialHeap tmp(std::move(other));
+            Swap(tmp);
+        }
+        return *this;
+    }
+
+    template<class Key>
+    void LazyBinomialHeap<Key>::Swap(LazyBinomialHeap<Key> &x) noexcept {
+        std::swap(head_, x.head_);
+        std::swap(tail_, x.tail_);
+        std::swap(minimal_, x.minimal_);
+        std::swap(size_, x.size_);
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_LAZY_BINOMIAL_H
@@ -6,19 +6,21 @@
 
 namespace heaps {
     // Leftist Heap implementation. Key is the type of data stored
-    template<class Key=int>
-    class LeftistHeap : public ClassicalHeap<Key, LeftistHeapNode<Key>> {
-        using Base = ClassicalHeap<Key, LeftistHeapNode<Key>>;
+    // Up to InlineCapacity keys are stored inline, without allocating the nodes.
+    // With BufferInserts the inserted keys are melded at once on the next extraction or merge.
+    template<class Key=int, size_t InlineCapacity = 0, bool BufferInserts = false>
+    class LeftistHeap : public ClassicalHeap<Key, LeftistHeapNode<Key>, InlineCapacity, BufferInserts> {
+        using Base = ClassicalHeap<Key, LeftistHeapNode<Key>, InlineCapacity, BufferInserts>;
     public:
+        // Constructor for empty heap
+        LeftistHeap() = default;
 
+        // Constructor for one-item heap
         explicit LeftistHeap(Key key);
     };
 
-    template<class Key>
-    LeftistHeap<Key>::LeftistHeap(Key key) {
-        Base::size_ = 1;
-        Base::root_ = new LeftistHeapNode<Key>(key, nullptr, nullptr, 0);
-    }
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    LeftistHeap<Key, InlineCapacity, BufferInserts>::LeftistHeap(Key key) : Base(key) {}
 } // namespace heaps
 
 #endif // MERGEABLE_HEAPS_LEFTIST_H
\ No newline at end of file
@@ -0,0 +1,170 @@
+#ifndef MERGEABLE_HEAPS_NORMALIZED_KEY_H
+#define MERGEABLE_HEAPS_NORMALIZED_KEY_H
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace heaps {
+    // Maps keys to order-preserving 64-bit prefixes: a < b implies Prefix(a) <= Prefix(b).
+    // The significant bits of the prefix are the kBits highest ones, the others are zero.
+    // If kExact is set, the keys with equal prefixes are equal.
+    // Not defined for the other types, specialize it for own keys, e.g. with the tuple normalizer on std::tie.
+    template<class Key, class = void>
+    struct KeyNormalizer;
+
+    // Integers: the sign bit is flipped, so the negative numbers go first.
+    template<class Key>
+    struct KeyNormalizer<Key, std::enable_if_t<std::is_integral_v<Key> && !std::is_same_v<Key, bool>>> {
+        static constexpr size_t kBits = std::numeric_limits<std::make_unsigned_t<Key>>::digits;
+        static constexpr bool kExact = true;
+
+        static uint64_t Prefix(Key key) {
+            auto bits = static_cast<uint64_t>(static_cast<std::make_unsigned_t<Key>>(key));
+            if constexpr (std::is_signed_v<Key>) {
+                bits ^= uint64_t(1) << (kBits - 1);
+            }
+            return bits << (64 - kBits);
+        }
+    };
+
+    // Floats: the bits of the negative numbers are inverted, the sign bit of the positive ones is set.
+    // -0.0 is mapped as 0.0. NaNs have no place in the order of the keys anyway.
+    template<class Key>
+    struct KeyNormalizer<Key, std::enable_if_t<std::is_floating_point_v<Key> && sizeof(Key) <= 8>> {
+        using Bits = std::conditional_t<sizeof(Key) == 4, uint32_t, uint64_t>;
+        static constexpr size_t kBits = 8 * sizeof(Key);
+        static constexpr bool kExact = true;
+
+        static uint64_t Prefix(Key key) {
+            key = key + Key(0);
+            Bits bits;
+            std::memcpy(&bits, &key, sizeof(bits));
+            constexpr Bits kSign = Bits(1) << (kBits - 1);
+            bits = (bits & kSign) != 0 ? Bits(~bits) : Bits(bits | kSign);
+            return static_cast<uint64_t>(bits) << (64 - kBits);
+        }
+    };
+
+    // Strings: the first 8 characters as unsigned bytes, big-endian. Shorter strings are padded with zeros,
+    // so "ab" and "ab\0" have equal prefixes and are compared in full.
+    // Only the standard traits compare the strings as unsigned bytes, the others may order them differently.
+    template<class Allocator>
+    struct KeyNormalizer<std::basic_string<char, std::char_traits<char>, Allocator>> {
+        static constexpr size_t kBits = 64;
+        static constexpr bool kExact = false;
+
+        static uint64_t Prefix(const std::basic_string<char, std::char_traits<char>, Allocator> &key) {
+            uint64_t prefix = 0;
+            const size_t length = key.size() < 8 ? key.size() : 8;
+            for (size_t i = 0; i < length; ++i) {
+                prefix |= static_cast<uint64_t>(static_cast<unsigned char>(key[i])) << (56 - 8 * i);
+            }
+            return prefix;
+        }
+    };
+
+    // Tuples and pairs: prefixes of the elements are concatenated while they are exact and fit into 64 bits.
+    // The last concatenated element may be cut.
+    template<class... Elements>
+    struct KeyNormalizer<std::tuple<Elements...>> {
+    private:
+        static_assert(sizeof...(Elements) > 0, "Empty tuples have no order to keep");
+
+        static constexpr std::array<size_t, sizeof...(Elements)> kElementBits{
+                KeyNormalizer<std::decay_t<Elements>>::kBits...};
+        static constexpr std::array<bool, sizeof...(Elements)> kElementExact{
+                KeyNormalizer<std::decay_t<Elements>>::kExact...};
+
+        // Number of the elements in the prefix
+        static constexpr size_t UsedElements() {
+            size_t bits = 0;
+            for (size_t i = 0; i < sizeof...(Elements); ++i) {
+                bits += kElementBits[i];
+                if (!kElementExact[i] || bits >= 64) {
+                    return i + 1;
+                }
+            }
+            return sizeof...(Elements);
+        }
+
+        // Total bits of the first count elements
+        static constexpr size_t SumBits(size_t count) {
+            size_t bits = 0;
+            for (size_t i = 0; i < count; ++i) {
+                bits += kElementBits[i];
+            }
+            return bits;
+        }
+
+        // Every element starts less than 64 bits from the top, as the concatenation stops at 64 bits.
+        template<size_t... Indices>
+        static uint64_t Concatenate(const std::tuple<Elements...> &key, std::index_sequence<Indices...>) {
+            return (0 | ... | (KeyNormalizer<std::decay_t<std::tuple_element_t<Indices, std::tuple<Elements...>>>>::Prefix(
+                    std::get<Indices>(key)) >> SumBits(Indices)));
+        }
+
+    public:
+        static constexpr size_t kBits = SumBits(UsedElements()) < 64 ? SumBits(UsedElements()) : 64;
+        static constexpr bool kExact = UsedElements() == sizeof...(Elements) &&
+                                       kElementExact[sizeof...(Elements) - 1] &&
+                                       SumBits(sizeof...(Elements)) <= 64;
+
+        static uint64_t Prefix(const std::tuple<Elements...> &key) {
+            return Concatenate(key, std::make_index_sequence<UsedElements()>());
+        }
+    };
+
+    template<class First, class Second>
+    struct KeyNormalizer<std::pair<First, Second>> {
+        using Tuple = std::tuple<const First &, const Second &>;
+        static constexpr size_t kBits = KeyNormalizer<Tuple>::kBits;
+        static constexpr bool kExact = KeyNormalizer<Tuple>::kExact;
+
+        static uint64_t Prefix(const std::pair<First, Second> &key) {
+            return KeyNormalizer<Tuple>::Prefix(Tuple(key.first, key.second));
+        }
+    };
+
+    // Key with its normalized prefix, which is compared first.
+    // The keys are compared in full only if the prefixes are equal and the normalizer isn't exact.
+    // Heaps of NormalizedKey<Key> store the prefix in the nodes next to the key.
+    template<class Key, class Normalizer = KeyNormalizer<Key>>
+    class NormalizedKey {
+    public:
+        NormalizedKey() : prefix_(0), key_() {}
+
+        // Implicit, so the heaps accept the plain keys.
+        NormalizedKey(Key key) : prefix_(Normalizer::Prefix(key)), key_(std::move(key)) {}
+
+        const Key &Get() const {
+            return key_;
+        }
+
+        uint64_t Prefix() const {
+            return prefix_;
+        }
+
+        bool operator<(const NormalizedKey &other) const {
+            if (prefix_ != other.prefix_ || Normalizer::kExact) {
+                return prefix_ < other.prefix_;
+            }
+            return key_ < other.key_;
+        }
+
+        bool operator==(const NormalizedKey &other) const {
+            return prefix_ == other.prefix_ && key_ == other.key_;
+        }
+
+    private:
+        uint64_t prefix_;
+        Key key_;
+    };
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_NORMALIZED_KEY_H
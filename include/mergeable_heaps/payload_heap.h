@@ -0,0 +1,264 @@
+#ifndef MERGEABLE_HEAPS_PAYLOAD_H
+#define MERGEABLE_HEAPS_PAYLOAD_H
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "exceptions.h"
+#include "conversion.h"
+#include "leftist_heap.h"
+
+namespace heaps {
+    // Storage of the payloads, which are addressed by 32-bit indices.
+    // Payloads are kept in a std::deque, so they are never moved, when the slab grows.
+    // The slab may be shared by several heaps of one thread, it is not synchronized.
+    template<class Value>
+    class PayloadSlab {
+    public:
+        // Stores the payload and returns its index.
+        uint32_t Put(Value value);
+
+        // Moves the payload out and frees its index.
+        Value Take(uint32_t index);
+
+        Value &operator[](uint32_t index);
+
+        // Number of the stored payloads
+        size_t Size() const;
+
+    private:
+        std::deque<Value> values_;
+        std::vector<uint32_t> free_;
+    };
+
+    template<class Value>
+    uint32_t PayloadSlab<Value>::Put(Value value) {
+        if (!free_.empty()) {
+            uint32_t index = free_.back();
+            free_.pop_back();
+            values_[index] = std::move(value);
+            return index;
+        }
+        values_.push_back(std::move(value));
+        return static_cast<uint32_t>(values_.size() - 1);
+    }
+
+    template<class Value>
+    Value PayloadSlab<Value>::Take(uint32_t index) {
+        Value value = std::move(values_[index]);
+        free_.push_back(index);
+        return value;
+    }
+
+    template<class Value>
+    Value &PayloadSlab<Value>::operator[](uint32_t index) {
+        return values_[index];
+    }
+
+    template<class Value>
+    size_t PayloadSlab<Value>::Size() const {
+        return values_.size() - free_.size();
+    }
+
+    // Heap of the items (priority, value), where the nodes of the Heap store only the priority
+    // and a 32-bit index of the value in a PayloadSlab. Comparisons and merges don't touch the values,
+    // which are moved into the slab on Push and out of it on PopMin and never copied.
+    // Heaps sharing one slab are merged as fast as the Heap. Otherwise the values of the merged heap
+    // are moved into the slab of *this, O(n) for the heaps with TakeKeys.
+    template<class Priority, class Value, template<class> class Heap = LeftistHeap>
+    class PayloadHeap {
+    private:
+        // Key of the inner heap
+        struct Entry {
+            Priority priority_;
+            uint32_t index_;
+
+            bool operator<(const Entry &other) const {
+                return priority_ < other.priority_;
+            }
+        };
+
+        Heap<Entry> heap_;
+        std::shared_ptr<PayloadSlab<Value>> slab_;
+
+        // Frees the values of the heap in the slab.
+        void Clear();
+
+    public:
+        // Constructor for empty heap with its own slab
+        PayloadHeap();
+
+        // Constructor for empty heap, which stores values in the given slab
+        explicit PayloadHeap(std::shared_ptr<PayloadSlab<Value>> slab);
+
+        // Inserts an item into the heap, the value is moved into the slab.
+        void Push(Priority priority, Value value);
+
+        // Return the minimal priority.
+        // Throws EmptyHeapException, if there is none
+        Priority TopPriority();
+
+        // Return the value of the item with the minimal priority. Valid until the item is popped.
+        // Throws EmptyHeapException, if there is none
+        Value &Top();
+
+        // Extracts the item with the minimal priority, the value is moved out.
+        // Throws EmptyHeapException, if there is none
+        std::pair<Priority, Value> PopMin();
+
+        // Merges x into *this. x becomes empty.
+        // Throws SelfHeapMergeException, if x is *this
+        void Merge(PayloadHeap &x);
+
+        // Return number of items in the heap
+        size_t Size();
+
+        // Checks if the heap is empty
+        bool Empty();
+
+        // Slab, which stores the values
+        std::shared_ptr<PayloadSlab<Value>> Slab() const;
+
+        //
+        // Rule of Five functions
+        //
+
+        // Destructor. Frees the values in the slab.
+        ~PayloadHeap();
+
+        // Values are not copyable in general, neither is the heap.
+        PayloadHeap(const PayloadHeap &other) = delete;
+
+        PayloadHeap &operator=(const PayloadHeap &other) = delete;
+
+        // Move constructor. Other heap is left empty with the same slab.
+        PayloadHeap(PayloadHeap &&other) noexcept;
+
+        // Move assignment operator
+        PayloadHeap &operator=(PayloadHeap &&other) noexcept;
+
+        // Swap function
+        void Swap(PayloadHeap &x) noexcept;
+    };
+
+    template<class Priority, class Value, template<class> class Heap>
+    PayloadHeap<Priority, Value, Heap>::PayloadHeap() : slab_(std::make_shared<PayloadSlab<Value>>()) {}
+
+    template<class Priority, class Value, template<class> class Heap>
+    PayloadHeap<Priority, Value, Heap>::PayloadHeap(std::shared_ptr<PayloadSlab<Value>> slab) : slab_(std::move(slab)) {}
+
+    template<class Priority, class Value, template<class> class Heap>
+    void PayloadHeap<Priority, Value, Heap>::Push(Priority priority, Value value) {
+        heap_.Insert(Entry{priority, slab_->Put(std::move(value))});
+    }
+
+    template<class Priority, class Value, template<class> class Heap>
+    Priority PayloadHeap<Priority, Value, Heap>::TopPriority() {
+        return heap_.GetMinimum().priority_;
+    }
+
+    template<class Priority, class Value, template<class> class Heap>
+    Value &PayloadHeap<Priority, Value, Heap>::Top() {
+        return (*slab_)[heap_.GetMinimum().index_];
+    }
+
+    template<class Priority, class Value, template<class> class Heap>
+    std::pair<Priority, Value> PayloadHeap<Priority, Value, Heap>::PopMin() {
+        Entry top = heap_.GetMinimum();
+        heap_.ExtractMinimum();
+        return {top.priority_, slab_->Take(top.index_)};
+    }
+
+    template<class Priority, class Value, template<class> class Heap>
+    void PayloadHeap<Priority, Value, Heap>::Merge(PayloadHeap &x) {
+        if (&x == this) {
+            throw SelfHeapMergeException();
+        }
+        if (slab_ == x.slab_) {
+            heap_.Merge(x.heap_);
+            return;
+        }
+        // Values are moved to the own slab, the entries are rebuilt with the new indices.
+        BulkBuilder<Heap<Entry>> builder;
+        auto move_entry = [&](const Entry &entry) {
+            builder.Add(Entry{entry.priority_, slab_->Put(x.slab_->Take(entry.index_))});
+        };
+        if constexpr (detail::HasTakeKeys<Heap<Entry>>::value) {
+            x.heap_.TakeKeys(move_entry);
+        } else {
+            while (!x.heap_.Empty()) {
+                move_entry(x.heap_.GetMinimum());
+                x.heap_.ExtractMinimum();
+            }
+        }
+        Heap<Entry> moved = builder.Build();
+        heap_.Merge(moved);
+    }
+
+    template<class Priority, class Value, template<class> class Heap>
+    size_t PayloadHeap<Priority, Value, Heap>::Size() {
+        return heap_.Size();
+    }
+
+    template<class Priority, class Value, template<class> class Heap>
+    bool PayloadHeap<Priority, Value, Heap>::Empty() {
+        return heap_.Empty();
+    }
+
+    template<class Priority, class Value, template<class> class Heap>
+    std::shared_ptr<PayloadSlab<Value>> PayloadHeap<Priority, Value, Heap>::Slab() const {
+        return slab_;
+    }
+
+    template<class Priority, class Value, template<class> class Heap>
+    void PayloadHeap<Priority, Value, Heap>::Clear() {
+        if (slab_ == nullptr) {
+            return;
+        }
+        // The heap owns its slab alone, the values are destroyed with it.
+        if (slab_.use_count() == 1) {
+            heap_ = Heap<Entry>();
+            return;
+        }
+        auto free_entry = [this](const Entry &entry) {
+            slab_->Take(entry.index_);
+        };
+        if constexpr (detail::HasTakeKeys<Heap<Entry>>::value) {
+            heap_.TakeKeys(free_entry);
+        } else {
+            while (!heap_.Empty()) {
+                free_entry(heap_.GetMinimum());
+                heap_.ExtractMinimum();
+            }
+        }
+    }
+
+    // Destructor
+    template<class Priority, class Value, template<class> class Heap>
+    PayloadHeap<Priority, Value, Heap>::~PayloadHeap() {
+        Clear();
+    }
+
+    // Move constructor
+    template<class Priority, class Value, template<class> class Heap>
+    PayloadHeap<Priority, Value, Heap>::PayloadHeap(PayloadHeap &&other) noexcept : heap_(std::move(other.heap_)),
+                                                                                   slab_(other.slab_) {}
+
+    // Move assignment operator
+    template<class Priority, class Value, template<class> class Heap>
+    PayloadHeap<Priority, Value, Heap> &PayloadHeap<Priority, Value, Heap>::operator=(PayloadHeap &&other) noexcept {
+        PayloadHeap tmp(std::move(other));
+        Swap(tmp);
+        return *this;
+    }
+
+    template<class Priority, class Value, template<class> class Heap>
+    void PayloadHeap<Priority, Value, Heap>::Swap(PayloadHeap &x) noexcept {
+        std::swap(heap_, x.heap_);
+        std::swap(slab_, x.slab_);
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_PAYLOAD_H
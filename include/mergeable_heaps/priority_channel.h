@@ -0,0 +1,301 @@
+#ifndef MERGEABLE_HEAPS_PRIORITY_CHANNEL_H
+#define MERGEABLE_HEAPS_PRIORITY_CHANNEL_H
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+#include "exceptions.h"
+#include "conversion.h"
+#include "leftist_heap.h"
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>
+// Set, if PriorityChannel provides the awaitable AsyncPop and AsyncPushBatch
+#define MERGEABLE_HEAPS_HAS_COROUTINES 1
+#endif
+
+namespace heaps {
+    // Multi-producer multi-consumer channel, which hands out the smallest key first.
+    // A batch of keys is melded into a Heap outside of the lock, so the lock is held for one Merge only:
+    // O(log n) for the leftist, skew and binomial heaps.
+    // Consumers of an empty channel wait in a FIFO queue. Every push hands the smallest keys to the oldest
+    // waiters and wakes exactly them: the threads through their own condition variables, the coroutines
+    // are resumed by the pushing thread after the lock is released.
+    // In C++20 the consumers and the producers may co_await AsyncPop and AsyncPushBatch.
+    template<class Key, template<class> class Heap = LeftistHeap>
+    class PriorityChannel {
+    public:
+        PriorityChannel() = default;
+
+        PriorityChannel(const PriorityChannel &) = delete;
+
+        PriorityChannel &operator=(const PriorityChannel &) = delete;
+
+        // Pushes one key.
+        // Throws ClosedChannelException, if the channel is closed
+        void Push(Key key);
+
+        // Pushes the keys, they are melded into a heap before the lock is taken.
+        // Throws ClosedChannelException, if the channel is closed
+        void PushBatch(const std::vector<Key> &keys);
+
+        // Merges the heap into the channel under the lock. The heap becomes empty.
+        // Throws ClosedChannelException, if the channel is closed
+        void PushBatch(Heap<Key> batch);
+
+        // Extracts the smallest key, waits for one, if the channel is empty.
+        // Returns std::nullopt, if the channel is closed and empty.
+        std::optional<Key> Pop();
+
+        // Extracts the smallest key, if there is one. Never waits.
+        std::optional<Key> TryPop();
+
+        // Rejects the further pushes and wakes all the waiters with std::nullopt.
+        // The keys already pushed can still be popped.
+        void Close();
+
+        // Return number of keys in the channel
+        size_t Size();
+
+        // Return number of consumers waiting for a key
+        size_t WaitersCount();
+
+#ifdef MERGEABLE_HEAPS_HAS_COROUTINES
+        class PopAwaiter;
+        class PushBatchAwaiter;
+
+        // co_await channel.AsyncPop() yields the same as Pop, but suspends the coroutine instead of blocking.
+        // The coroutine is resumed on the thread, which pushes the key.
+        PopAwaiter AsyncPop();
+
+        // co_await channel.AsyncPushBatch(keys) is PushBatch, the keys are melded at the call.
+        // Never suspends, the waiting consumers are resumed before it returns.
+        PushBatchAwaiter AsyncPushBatch(const std::vector<Key> &keys);
+#endif
+
+    private:
+        // Consumer waiting for a key. Lives on the stack of the thread or in the frame of the coroutine.
+        struct Waiter {
+            std::optional<Key> item_;
+            // Threads wait on cv_ until woken_ is set.
+            std::condition_variable *cv_ = nullptr;
+            bool woken_ = false;
+            // Coroutines are resumed by resume_(coroutine_).
+            void (*resume_)(void *) = nullptr;
+            void *coroutine_ = nullptr;
+        };
+
+        std::mutex mutex_;
+        Heap<Key> heap_;
+        std::deque<Waiter *> waiters_;
+        bool closed_ = false;
+
+        // Takes the smallest key into item. Called under the lock.
+        bool TakeMinimum(std::optional<Key> &item);
+
+        // Hands the smallest keys to the oldest waiters. Called under the lock.
+        // The threads are notified at once, the coroutines are moved to resumed, as they can't run under the lock.
+        void Deliver(std::vector<Waiter *> &resumed);
+
+        // Resumes the coroutines after the lock is released. The waiters are destroyed on the way.
+        static void Resume(const std::vector<Waiter *> &resumed);
+    };
+
+    template<class Key, template<class> class Heap>
+    void PriorityChannel<Key, Heap>::Push(Key key) {
+        std::vector<Waiter *> resumed;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (closed_) {
+                throw ClosedChannelException();
+            }
+            heap_.Insert(key);
+            Deliver(resumed);
+        }
+        Resume(resumed);
+    }
+
+    template<class Key, template<class> class Heap>
+    void PriorityChannel<Key, Heap>::PushBatch(const std::vector<Key> &keys) {
+        BulkBuilder<Heap<Key>> builder;
+        for (const Key &key: keys) {
+            builder.Add(key);
+        }
+        PushBatch(builder.Build());
+    }
+
+    template<class Key, template<class> class Heap>
+    void PriorityChannel<Key, Heap>::PushBatch(Heap<Key> batch) {
+        std::vector<Waiter *> resumed;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (closed_) {
+                throw ClosedChannelException();
+            }
+            heap_.Merge(batch);
+            Deliver(resumed);
+        }
+        Resume(resumed);
+    }
+
+    template<class Key, template<class> class Heap>
+    std::optional<Key> PriorityChannel<Key, Heap>::Pop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        std::optional<Key> item;
+        if (TakeMinimum(item) || closed_) {
+            return item;
+        }
+        std::condition_variable cv;
+        Waiter waiter;
+        waiter.cv_ = &cv;
+        waiters_.push_back(&waiter);
+        cv.wait(lock, [&waiter] { return waiter.woken_; });
+        return std::move(waiter.item_);
+    }
+
+    template<class Key, template<class> class Heap>
+    std::optional<Key> PriorityChannel<Key, Heap>::TryPop() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::optional<Key> item;
+        TakeMinimum(item);
+        return item;
+    }
+
+    template<class Key, template<class> class Heap>
+    void PriorityChannel<Key, Heap>::Close() {
+        std::vector<Waiter *> resumed;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+            // The heap is empty, when anyone waits.
+            for (Waiter *waiter: waiters_) {
+                if (waiter->resume_ != nullptr) {
+                    resumed.push_back(waiter);
+                } else {
+                    waiter->woken_ = true;
+                    waiter->cv_->notify_one();
+                }
+            }
+            waiters_.clear();
+        }
+        Resume(resumed);
+    }
+
+    template<class Key, template<class> class Heap>
+    size_t PriorityChannel<Key, Heap>::Size() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return heap_.Size();
+    }
+
+    template<class Key, template<class> class Heap>
+    size_t PriorityChannel<Key, Heap>::WaitersCount() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return waiters_.size();
+    }
+
+    template<class Key, template<class> class Heap>
+    bool PriorityChannel<Key, Heap>::TakeMinimum(std::optional<Key> &item) {
+        if (heap_.Empty()) {
+            return false;
+        }
+        item = heap_.GetMinimum();
+        heap_.ExtractMinimum();
+        return true;
+    }
+
+    template<class Key, template<class> class Heap>
+    void PriorityChannel<Key, Heap>::Deliver(std::vector<Waiter *> &resumed) {
+        while (!waiters_.empty() && TakeMinimum(waiters_.front()->item_)) {
+            Waiter *waiter = waiters_.front();
+            waiters_.pop_front();
+            if (waiter->resume_ != nullptr) {
+                resumed.push_back(waiter);
+            } else {
+                waiter->woken_ = true;
+                waiter->cv_->notify_one();
+            }
+        }
+    }
+
+    template<class Key, template<class> class Heap>
+    void PriorityChannel<Key, Heap>::Resume(const std::vector<Waiter *> &resumed) {
+        for (Waiter *waiter: resumed) {
+            waiter->resume_(waiter->coroutine_);
+        }
+    }
+
+#ifdef MERGEABLE_HEAPS_HAS_COROUTINES
+    template<class Key, template<class> class Heap>
+    class PriorityChannel<Key, Heap>::PopAwaiter {
+    public:
+        explicit PopAwaiter(PriorityChannel &channel) : channel_(channel) {}
+
+        // The check is done in await_suspend under the lock.
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        // Returns false, if there is a key or the channel is closed, so the coroutine goes on.
+        bool await_suspend(std::coroutine_handle<> handle) {
+            std::lock_guard<std::mutex> lock(channel_.mutex_);
+            if (channel_.TakeMinimum(waiter_.item_) || channel_.closed_) {
+                return false;
+            }
+            waiter_.resume_ = [](void *coroutine) {
+                std::coroutine_handle<>::from_address(coroutine).resume();
+            };
+            waiter_.coroutine_ = handle.address();
+            channel_.waiters_.push_back(&waiter_);
+            return true;
+        }
+
+        std::optional<Key> await_resume() {
+            return std::move(waiter_.item_);
+        }
+
+    private:
+        PriorityChannel &channel_;
+        Waiter waiter_;
+    };
+
+    template<class Key, template<class> class Heap>
+    class PriorityChannel<Key, Heap>::PushBatchAwaiter {
+    public:
+        PushBatchAwaiter(PriorityChannel &channel, Heap<Key> batch) : channel_(channel), batch_(std::move(batch)) {}
+
+        bool await_ready() const noexcept {
+            return true;
+        }
+
+        void await_suspend(std::coroutine_handle<>) const noexcept {}
+
+        void await_resume() {
+            channel_.PushBatch(std::move(batch_));
+        }
+
+    private:
+        PriorityChannel &channel_;
+        Heap<Key> batch_;
+    };
+
+    template<class Key, template<class> class Heap>
+    typename PriorityChannel<Key, Heap>::PopAwaiter PriorityChannel<Key, Heap>::AsyncPop() {
+        return PopAwaiter(*this);
+    }
+
+    template<class Key, template<class> class Heap>
+    typename PriorityChannel<Key, Heap>::PushBatchAwaiter
+    PriorityChannel<Key, Heap>::AsyncPushBatch(const std::vector<Key> &keys) {
+        BulkBuilder<Heap<Key>> builder;
+        for (const Key &key: keys) {
+            builder.Add(key);
+        }
+        return PushBatchAwaiter(*this, builder.Build());
+    }
+#endif
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_PRIORITY_CHANNEL_H
@@ -0,0 +1,219 @@
+#ifndef MERGEABLE_HEAPS_RADIX_H
+#define MERGEABLE_HEAPS_RADIX_H
+
+#include <array>
+#include <cassert>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+#include "heap_interface.h"
+#include "exceptions.h"
+
+namespace heaps {
+    // Radix Heap for monotone integer priorities, as in Dijkstra's algorithm or event simulation.
+    // Items are pairs (priority, value). Inserted priorities must not be less than the last extracted one,
+    // it's checked in debug builds only. Items are kept in buckets indexed by the highest bit, in which
+    // their priority differs from the last extracted one, buckets are contiguous vectors.
+    // Insert is O(1), ExtractMinimum is amortized O(log C), where C is the range of priorities.
+    template<class UInt, class Value>
+    class RadixHeap : public HeapInterface<std::pair<UInt, Value>> {
+        static_assert(std::is_unsigned_v<UInt>, "RadixHeap priorities must be unsigned integers");
+    public:
+        using Key = std::pair<UInt, Value>;
+
+    private:
+        static constexpr size_t kBucketsCnt = std::numeric_limits<UInt>::digits + 1;
+
+        // buckets_[0] contains items with the priority equal to last_,
+        // buckets_[i] contains items, which priority differs from last_ in the bit i - 1 first.
+        std::array<std::vector<Key>, kBucketsCnt> buckets_;
+        // The last extracted priority. All the priorities in the heap are not less.
+        UInt last_;
+        // Number of items in the heap
+        size_t size_;
+
+        // Returns the index of the bucket for the priority relative to the base.
+        static size_t BucketIndex(UInt priority, UInt base);
+
+        // Returns the index of the first non-empty bucket. Heap must not be empty.
+        size_t FirstBucket() const;
+
+        // Makes "base" the new last_ and moves all the items to the corresponding buckets.
+        void Rebase(UInt base);
+
+    public:
+        // Constructor for empty heap
+        RadixHeap();
+
+        // Constructor for one-item heap
+        explicit RadixHeap(Key key);
+
+        // Inserts an item into the heap.
+        // The priority must not be less than the last extracted one.
+        void Insert(Key x) override;
+
+        // Return the item with the minimal priority.
+        // Throws EmptyHeapException, if there is none
+        Key GetMinimum() override;
+
+        // Extracts the item with the minimal priority.
+        // Throws EmptyHeapException, if there is none
+        void ExtractMinimum() override;
+
+        // Merges an abstract heap into *this, items of x are redistributed over the buckets of *this.
+        // The smaller of two last extracted priorities becomes the bound for the future insertions.
+        // Throws WrongHeapTypeException, if x is not a RadixHeap
+        void Merge(HeapInterface<Key> &x) override;
+
+        // Return number of items in the heap
+        size_t Size() override;
+
+        // Checks if the heap is empty
+        bool Empty() override;
+
+        // Drops all the items from the heap, nodes are not used.
+        void Detach() override;
+
+        // Returns sorted std::vector with all the items from the heap.
+        // Mainly for debug purposes.
+        std::vector<Key> Data();
+    };
+
+    template<class UInt, class Value>
+    RadixHeap<UInt, Value>::RadixHeap() : last_(0), size_(0) {}
+
+    template<class UInt, class Value>
+    RadixHeap<UInt, Value>::RadixHeap(Key key) : RadixHeap() {
+        Insert(std::move(key));
+    }
+
+    template<class UInt, class Value>
+    size_t RadixHeap<UInt, Value>::BucketIndex(UInt priority, UInt base) {
+        auto difference = static_cast<unsigned long long>(priority ^ base);
+        return difference == 0 ? 0 : std::numeric_limits<unsigned long long>::digits - __builtin_clzll(difference);
+    }
+
+    template<class UInt, class Value>
+    size_t RadixHeap<UInt, Value>::FirstBucket() const {
+        size_t i = 0;
+        while (buckets_[i].empty()) {
+            ++i;
+        }
+        return i;
+    }
+
+    template<class UInt, class Value>
+    void RadixHeap<UInt, Value>::Insert(Key x) {
+        assert(!(x.first < last_) && "RadixHeap priorities must not decrease below the last extracted one");
+        buckets_[BucketIndex(x.first, last_)].push_back(std::move(x));
+        ++size_;
+    }
+
+    template<class UInt, class Value>
+    typename RadixHeap<UInt, Value>::Key RadixHeap<UInt, Value>::GetMinimum() {
+        if (Empty()) {
+            throw EmptyHeapException();
+        }
+        // Priorities in buckets_[0] are equal, the item at the front is extracted first.
+        if (!buckets_[0].empty()) {
+            return buckets_[0].front();
+        }
+        // The first minimal item of the bucket goes to the front of buckets_[0] on the redistribution.
+        const auto &bucket = buckets_[FirstBucket()];
+        return *std::min_element(bucket.begin(), bucket.end(), [](const Key &a, const Key &b) {
+            return a.first < b.first;
+        });
+    }
+
+    template<class UInt, class Value>
+    void RadixHeap<UInt, Value>::ExtractMinimum() {
+        if (Empty()) {
+            throw EmptyHeapException();
+        }
+        if (buckets_[0].empty()) {
+            size_t i = FirstBucket();
+            auto &bucket = buckets_[i];
+            UInt minimum = std::min_element(bucket.begin(), bucket.end(), [](const Key &a, const Key &b) {
+                return a.first < b.first;
+            })->first;
+            // Relative to the new minimum all the items of the bucket go to the lower ones.
+            for (auto &item: bucket) {
+                buckets_[BucketIndex(item.first, minimum)].push_back(std::move(item));
+            }
+            bucket.clear();
+            last_ = minimum;
+        }
+        // The front item is the one reported by GetMinimum.
+        std::swap(buckets_[0].front(), buckets_[0].back());
+        buckets_[0].pop_back();
+        --size_;
+    }
+
+    template<class UInt, class Value>
+    void RadixHeap<UInt, Value>::Rebase(UInt base) {
+        std::array<std::vector<Key>, kBucketsCnt> old_buckets;
+        std::swap(old_buckets, buckets_);
+        last_ = base;
+        for (auto &bucket: old_buckets) {
+            for (auto &item: bucket) {
+                buckets_[BucketIndex(item.first, last_)].push_back(std::move(item));
+            }
+        }
+    }
+
+    template<class UInt, class Value>
+    void RadixHeap<UInt, Value>::Merge(HeapInterface<Key> &x) {
+        if (&x == this) {
+            throw SelfHeapMergeException();
+        }
+        try {
+            auto &casted = dynamic_cast<RadixHeap<UInt, Value> &>(x);
+            if (casted.last_ < last_) {
+                Rebase(casted.last_);
+            }
+            for (auto &bucket: casted.buckets_) {
+                for (auto &item: bucket) {
+                    buckets_[BucketIndex(item.first, last_)].push_back(std::move(item));
+                }
+            }
+            size_ += casted.size_;
+            x.Detach();
+        } catch (const std::bad_cast &e) {
+            throw WrongHeapTypeException();
+        }
+    }
+
+    template<class UInt, class Value>
+    size_t RadixHeap<UInt, Value>::Size() {
+        return size_;
+    }
+
+    template<class UInt, class Value>
+    bool RadixHeap<UInt, Value>::Empty() {
+        return size_ == 0;
+    }
+
+    template<class UInt, class Value>
+    void RadixHeap<UInt, Value>::Detach() {
+        for (auto &bucket: buckets_) {
+            bucket.clear();
+        }
+        last_ = 0;
+        size_ = 0;
+    }
+
+    template<class UInt, class Value>
+    std::vector<typename RadixHeap<UInt, Value>::Key> RadixHeap<UInt, Value>::Data() {
+        std::vector<Key> data;
+        data.reserve(size_);
+        for (const auto &bucket: buckets_) {
+            data.insert(data.end(), bucket.begin(), bucket.end());
+        }
+        std::sort(data.begin(), data.end());
+        return data;
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_RADIX_H
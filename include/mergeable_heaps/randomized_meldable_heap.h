@@ -0,0 +1,306 @@
+#ifndef MERGEABLE_HEAPS_RANDOMIZED_MELDABLE_H
+#define MERGEABLE_HEAPS_RANDOMIZED_MELDABLE_H
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include "heap_interface.h"
+#include "exceptions.h"
+#include "nodes/randomized_meldable_heap_node.h"
+
+namespace heaps {
+    namespace detail {
+        // Source of random bits: xorshift64*, 32 high bits of every output are used one by one.
+        class RandomBits {
+        public:
+            explicit RandomBits(uint64_t seed);
+
+            bool operator()();
+
+        private:
+            uint64_t state_;
+            uint32_t bits_;
+            uint32_t left_;
+        };
+
+        inline RandomBits::RandomBits(uint64_t seed) : state_(seed | 1), bits_(0), left_(0) {}
+
+        inline bool RandomBits::operator()() {
+            if (left_ == 0) {
+                state_ ^= state_ >> 12;
+                state_ ^= state_ << 25;
+                state_ ^= state_ >> 27;
+                bits_ = static_cast<uint32_t>((state_ * 2685821657736338717ULL) >> 32);
+                left_ = 32;
+            }
+            const bool bit = (bits_ & 1) != 0;
+            bits_ >>= 1;
+            --left_;
+            return bit;
+        }
+
+        // Distinct seeds for the heaps, splitmix64 of a global counter.
+        inline uint64_t NextHeapSeed() {
+            static std::atomic<uint64_t> counter{0};
+            uint64_t z = (counter.fetch_add(1, std::memory_order_relaxed) + 1) * 0x9E3779B97F4A7C15ULL;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+        }
+    } // namespace detail
+
+    // Randomized Meldable Heap implementation. Key is the type of data stored
+    // Nodes store no rank or degree, the merge descends into a random child of the smaller root.
+    // Every operation is O(log n) with high probability, the random bits come from a per-heap xorshift generator.
+    template<class Key>
+    class RandomizedMeldableHeap : public HeapInterface<Key> {
+    private:
+        using Node = RandomizedMeldableHeapNode<Key>;
+
+        // Root of the tree. Equal to nullptr, if the heap is empty.
+        Node *root_;
+        // Number of items in the heap
+        size_t size_;
+        detail::RandomBits random_bit_;
+
+    public:
+        // Constructor for empty heap
+        RandomizedMeldableHeap();
+
+        // Constructor for one-item heap
+        explicit RandomizedMeldableHeap(Key key);
+
+        // Inserts an item into the heap
+        void Insert(Key x) override;
+
+        // Return the minimal item in heap.
+        // Throws EmptyHeapException, if there is none
+        Key GetMinimum() override;
+
+        // Extracts minimal item from the heap
+        // Throws EmptyHeapException, if there is none
+        void ExtractMinimum() override;
+
+        // Merges an abstract heap into *this
+        // Throws WrongHeapTypeException, if x is not a RandomizedMeldableHeap
+        void Merge(HeapInterface<Key> &x) override;
+
+        // Return number of items in the heap
+        size_t Size() override;
+
+        // Checks if the heap is empty
+        bool Empty() override;
+
+        // Detaches heap from its nodes without deleting them
+        // Now, it's user's responsibility to free node's memory.
+        void Detach() override;
+
+        // Adds delta to all the keys in O(1), the delta is pushed down lazily.
+        // Key must support operator+, which keeps the order of the keys.
+        void AddToAll(const Key &delta);
+
+        // Passes all the keys to callback in no particular order and deletes the nodes on the way.
+        // The heap becomes empty. O(n)
+        template<class Callback>
+        void TakeKeys(Callback &&callback);
+
+        // Returns sorted std::vector with all the keys from the heap.
+        // Mainly for debug purposes.
+        std::vector<Key> Data();
+
+        //
+        // Rule of Five functions
+        //
+
+        // Destructor. Destructs the heap with all it's nodes
+        ~RandomizedMeldableHeap();
+
+        // Copy constructor. Creates the copy of the heap and all it's nodes, the generator is seeded anew.
+        RandomizedMeldableHeap(const RandomizedMeldableHeap &other);
+
+        // Move constructor. Creates the copy of the heap by stealing resources.
+        // Other heap is left as newly initialized.
+        RandomizedMeldableHeap(RandomizedMeldableHeap &&other) noexcept;
+
+        // Copy assignment operator
+        RandomizedMeldableHeap &operator=(const RandomizedMeldableHeap &other);
+
+        // Move assignment operator
+        RandomizedMeldableHeap &operator=(RandomizedMeldableHeap &&other) noexcept;
+
+        // Swap function for "Copy and Swap" idiom. Generators stay with their heaps.
+        void Swap(RandomizedMeldableHeap &x) noexcept;
+    };
+
+    template<class Key>
+    RandomizedMeldableHeap<Key>::RandomizedMeldableHeap() : root_(nullptr), size_(0),
+                                                            random_bit_(detail::NextHeapSeed()) {}
+
+    template<class Key>
+    RandomizedMeldableHeap<Key>::RandomizedMeldableHeap(Key key) : RandomizedMeldableHeap() {
+        Insert(key);
+    }
+
+    template<class Key>
+    void RandomizedMeldableHeap<Key>::Insert(Key x) {
+        auto *v = new Node();
+        v->key_ = x;
+        root_ = Node::Merge_(root_, v, random_bit_);
+        ++size_;
+    }
+
+    template<class Key>
+    Key RandomizedMeldableHeap<Key>::GetMinimum() {
+        if (Empty()) {
+            throw EmptyHeapException();
+        }
+        return root_->key_;
+    }
+
+    template<class Key>
+    void RandomizedMeldableHeap<Key>::ExtractMinimum() {
+        if (Empty()) {
+            throw EmptyHeapException();
+        }
+        root_->PushDown();
+        Node *left = root_->child_left_;
+        Node *right = root_->child_right_;
+        root_->Detach();
+        delete root_;
+        root_ = Node::Merge_(left, right, random_bit_);
+        --size_;
+    }
+
+    template<class Key>
+    void RandomizedMeldableHeap<Key>::Merge(HeapInterface<Key> &x) {
+        if (&x == this) {
+            throw SelfHeapMergeException();
+        }
+        try {
+            auto &casted = dynamic_cast<RandomizedMeldableHeap<Key> &>(x);
+            root_ = Node::Merge_(root_, casted.root_, random_bit_);
+            size_ += casted.size_;
+            x.Detach();
+        } catch (const std::bad_cast &e) {
+            throw WrongHeapTypeException();
+        }
+    }
+
+    template<class Key>
+    size_t RandomizedMeldableHeap<Key>::Size() {
+        return size_;
+    }
+
+    template<class Key>
+    bool RandomizedMeldableHeap<Key>::Empty() {
+        return root_ == nullptr;
+    }
+
+    template<class Key>
+    void RandomizedMeldableHeap<Key>::Detach() {
+        root_ = nullptr;
+        size_ = 0;
+    }
+
+    template<class Key>
+    void RandomizedMeldableHeap<Key>::AddToAll(const Key &delta) {
+        static_assert(kAdditiveKey<Key>, "AddToAll requires keys with operator+");
+        if (root_ != nullptr) {
+            root_->AddToSubtree(delta);
+        }
+    }
+
+    template<class Key>
+    template<class Callback>
+    void RandomizedMeldableHeap<Key>::TakeKeys(Callback &&callback) {
+        std::vector<Node *> stack;
+        if (root_ != nullptr) {
+            stack.push_back(root_);
+        }
+        while (!stack.empty()) {
+            Node *v = stack.back();
+            stack.pop_back();
+            v->PushDown();
+            for (Node *child: {v->child_left_, v->child_right_}) {
+                if (child != nullptr) {
+                    stack.push_back(child);
+                }
+            }
+            callback(v->key_);
+            v->Detach();
+            delete v;
+        }
+        Detach();
+    }
+
+    template<class Key>
+    std::vector<Key> RandomizedMeldableHeap<Key>::Data() {
+        std::vector<Key> data;
+        data.reserve(size_);
+        std::vector<Node *> stack;
+        if (root_ != nullptr) {
+            stack.push_back(root_);
+        }
+        while (!stack.empty()) {
+            Node *v = stack.back();
+            stack.pop_back();
+            data.push_back(v->key_);
+            v->PushDown();
+            for (Node *child: {v->child_left_, v->child_right_}) {
+                if (child != nullptr) {
+                    stack.push_back(child);
+                }
+            }
+        }
+        std::sort(data.begin(), data.end());
+        return data;
+    }
+
+    // Destructor
+    template<class Key>
+    RandomizedMeldableHeap<Key>::~RandomizedMeldableHeap() {
+        delete root_;
+    }
+
+    // Copy constructor
+    template<class Key>
+    RandomizedMeldableHeap<Key>::RandomizedMeldableHeap(const RandomizedMeldableHeap &other) :
+            root_(other.root_ == nullptr ? nullptr : new Node(*other.root_)), size_(other.size_),
+            random_bit_(detail::NextHeapSeed()) {}
+
+    // Move constructor
+    template<class Key>
+    RandomizedMeldableHeap<Key>::RandomizedMeldableHeap(RandomizedMeldableHeap &&other) noexcept :
+            RandomizedMeldableHeap() {
+        Swap(other);
+    }
+
+    // Copy assignment operator
+    template<class Key>
+    RandomizedMeldableHeap<Key> &RandomizedMeldableHeap<Key>::operator=(const RandomizedMeldableHeap &other) {
+        if (this != &other) {
+            RandomizedMeldableHeap tmp(other);
+            Swap(tmp);
+        }
+        return *this;
+    }
+
+    // Move assignment operator
+    template<class Key>
+    RandomizedMeldableHeap<Key> &RandomizedMeldableHeap<Key>::operator=(RandomizedMeldableHeap &&other) noexcept {
+        if (this != &other) {
+            RandomizedMeldableHeap tmp(std::move(other));
+            Swap(tmp);
+        }
+        return *this;
+    }
+
+    template<class Key>
+    void RandomizedMeldableHeap<Key>::Swap(RandomizedMeldableHeap &x) noexcept {
+        std::swap(root_, x.root_);
+        std::swap(size_, x.size_);
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_RANDOMIZED_MELDABLE_H
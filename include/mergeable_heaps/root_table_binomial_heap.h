@@ -0,0 +1,336 @@
+#ifndef MERGEABLE_HEAPS_ROOT_TABLE_BINOMIAL_H
+#define MERGEABLE_HEAPS_ROOT_TABLE_BINOMIAL_H
+
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include "heap_interface.h"
+#include "exceptions.h"
+#include "nodes/binomial_heap_node.h"
+
+namespace heaps {
+    // Binomial Heap, which stores its roots in a table indexed by degree
+    // instead of a linked list. Occupied slots are marked in a bitmask,
+    // so merging two heaps is a binary addition with carry over the bits.
+    // The root with the minimal key is cached, GetMinimum is O(1).
+    // The table makes the heap object itself heavy (64 pointers),
+    // so prefer BinomialHeap for lots of tiny heaps.
+    template<class Key>
+    class RootTableBinomialHeap : public HeapInterface<Key> {
+    private:
+        // Degree of a tree can't exceed the number of bits in size_t.
+        static constexpr size_t kMaxDegree = 64;
+
+        using Table = std::array<BinomialHeapNode<Key> *, kMaxDegree>;
+
+        // roots_[i] is the root of the tree with degree i,
+        // valid only if i-th bit of occupied_ is set.
+        Table roots_;
+        uint64_t occupied_;
+        // Degree of the root with the minimal key. Valid, if heap is not empty.
+        size_t minimal_degree_;
+        // Number of items in the heap
+        size_t size_;
+
+        // Links two trees of the same degree. The one with the smaller key becomes the root.
+        static BinomialHeapNode<Key> *Link(BinomialHeapNode<Key> *v1, BinomialHeapNode<Key> *v2);
+
+        // Adds trees from the table "trees" (occupied slots are set in "mask") to *this.
+        // Works as a binary addition with carry. Doesn't update the cached minimum.
+        void AddTrees(Table &trees, uint64_t mask);
+
+        // Scans the occupied slots and updates minimal_degree_.
+        void UpdateMinimum();
+
+    public:
+        // Constructor for empty heap
+        RootTableBinomialHeap();
+
+        // Constructor for one-item heap
+        explicit RootTableBinomialHeap(Key key);
+
+        // Inserts an item into the heap. Amortized O(1).
+        void Insert(Key x) override;
+
+        // Return the minimal item in heap. O(1)
+        // Throws EmptyHeapException, if there is none
+        Key GetMinimum() override;
+
+        // Extracts minimal item from the heap.
+        // Throws EmptyHeapException, if there is none
+        void ExtractMinimum() override;
+
+        // Merges an abstract heap into *this.
+        // Throws WrongHeapTypeException, if x is not a RootTableBinomialHeap
+        void Merge(HeapInterface<Key> &x) override;
+
+        // Return number of items in the heap
+        size_t Size() override;
+
+        // Checks if the heap is empty
+        bool Empty() override;
+
+        // Detaches heap from its nodes without deleting them
+        // Now, it's user's responsibility to free node's memory.
+        void Detach() override;
+
+        // Passes all the keys to callback in no particular order and deletes the nodes on the way.
+        // The heap becomes empty. O(n)
+        template<class Callback>
+        void TakeKeys(Callback &&callback);
+
+        // Returns sorted std::vector with all the keys from the heap.
+        // Mainly for debug purposes.
+        std::vector<Key> Data();
+
+        //
+        // Rule of Five functions
+        //
+
+        // Destructor. Destructs the heap with all it's nodes
+        // Unless they are detached.
+        ~RootTableBinomialHeap();
+
+        // Copy constructor. Creates the copy of the heap and all it's nodes
+        RootTableBinomialHeap(const RootTableBinomialHeap<Key> &other);
+
+        // Move constructor. Creates the copy of the heap by stealing resources.
+        // Other heap is left as newly initialized.
+        RootTableBinomialHeap(RootTableBinomialHeap<Key> &&other) noexcept;
+
+        // Copy assignment operator
+        RootTableBinomialHeap<Key> &operator=(const RootTableBinomialHeap<Key> &other);
+
+        // Move assignment operator
+        RootTableBinomialHeap<Key> &operator=(RootTableBinomialHeap<Key> &&other) noexcept;
+
+        // Swap function for "Copy and Swap" idiom
+        void Swap(RootTableBinomialHeap<Key> &x) noexcept;
+    };
+
+    template<class Key>
+    RootTableBinomialHeap<Key>::RootTableBinomialHeap() : occupied_(0), minimal_degree_(0), size_(0) {}
+
+    template<class Key>
+    RootTableBinomialHeap<Key>::RootTableBinomialHeap(Key key) : RootTableBinomialHeap() {
+        Insert(key);
+    }
+
+    template<class Key>
+    BinomialHeapNode<Key> *RootTableBinomialHeap<Key>::Link(BinomialHeapNode<Key> *v1, BinomialHeapNode<Key> *v2) {
+        if (v2->key_ < v1->key_) {
+            std::swap(v1, v2);
+        }
+        v1->Merge_(v2);
+        return v1;
+    }
+
+    template<class Key>
+    void RootTableBinomialHeap<Key>::Insert(Key x) {
+        BinomialHeapNode<Key> *carry = new BinomialHeapNode<Key>(x, nullptr, nullptr, nullptr, 0u);
+        // The cached minimum may be consumed by the carry chain.
+        // In that case the carry contains it and becomes the new minimum.
+        bool minimum_consumed = false;
+        size_t degree = 0;
+        while (occupied_ >> degree & 1u) {
+            minimum_consumed |= degree == minimal_degree_;
+            carry = Link(roots_[degree], carry);
+            occupied_ &= ~(uint64_t(1) << degree);
+            ++degree;
+        }
+        roots_[degree] = carry;
+        occupied_ |= uint64_t(1) << degree;
+        if (size_ == 0 || minimum_consumed || carry->key_ < roots_[minimal_degree_]->key_) {
+            minimal_degree_ = degree;
+        }
+        ++size_;
+    }
+
+    template<class Key>
+    Key RootTableBinomialHeap<Key>::GetMinimum() {
+        if (Empty()) {
+            throw EmptyHeapException();
+        }
+        return roots_[minimal_degree_]->key_;
+    }
+
+    template<class Key>
+    void RootTableBinomialHeap<Key>::ExtractMinimum() {
+        if (Empty()) {
+            throw EmptyHeapException();
+        }
+        BinomialHeapNode<Key> *v = roots_[minimal_degree_];
+        occupied_ &= ~(uint64_t(1) << minimal_degree_);
+
+        // Children of the tree with degree d have degrees d - 1, ..., 0
+        // and form a binomial heap of their own.
+        Table children;
+        uint64_t mask = 0;
+        for (BinomialHeapNode<Key> *i = v->child_; i != nullptr;) {
+            BinomialHeapNode<Key> *next = i->sibling_;
+            i->sibling_ = nullptr;
+            i->parent_ = nullptr;
+            children[i->degree_] = i;
+            mask |= uint64_t(1) << i->degree_;
+            i = next;
+        }
+        v->Detach();
+        delete v;
+
+        AddTrees(children, mask);
+        --size_;
+        UpdateMinimum();
+    }
+
+    template<class Key>
+    void RootTableBinomialHeap<Key>::AddTrees(Table &trees, uint64_t mask) {
+        BinomialHeapNode<Key> *carry = nullptr;
+        const uint64_t bits = occupied_ | mask;
+        for (size_t degree = 0; degree < kMaxDegree; ++degree) {
+            if (carry == nullptr && (bits >> degree) == 0) {
+                break;
+            }
+            BinomialHeapNode<Key> *summands[3];
+            size_t count = 0;
+            if (occupied_ >> degree & 1u) {
+                summands[count++] = roots_[degree];
+            }
+            if (mask >> degree & 1u) {
+                summands[count++] = trees[degree];
+            }
+            if (carry != nullptr) {
+                summands[count++] = carry;
+            }
+            // The same rules as in binary addition: one tree stays in the slot
+            // if the count is odd, a pair is linked into the carry.
+            carry = count >= 2 ? Link(summands[count - 1], summands[count - 2]) : nullptr;
+            if (count % 2 == 1) {
+                roots_[degree] = summands[0];
+                occupied_ |= uint64_t(1) << degree;
+            } else {
+                occupied_ &= ~(uint64_t(1) << degree);
+            }
+        }
+    }
+
+    template<class Key>
+    void RootTableBinomialHeap<Key>::UpdateMinimum() {
+        minimal_degree_ = 0;
+        bool found = false;
+        for (uint64_t bits = occupied_; bits != 0; bits &= bits - 1) {
+            auto degree = static_cast<size_t>(__builtin_ctzll(bits));
+            if (!found || roots_[degree]->key_ < roots_[minimal_degree_]->key_) {
+                minimal_degree_ = degree;
+                found = true;
+            }
+        }
+    }
+
+    template<class Key>
+    void RootTableBinomialHeap<Key>::Merge(HeapInterface<Key> &x) {
+        if (&x == this) {
+            throw SelfHeapMergeException();
+        }
+        try {
+            auto &casted = dynamic_cast<RootTableBinomialHeap<Key> &>(x);
+            AddTrees(casted.roots_, casted.occupied_);
+            size_ += casted.size_;
+            UpdateMinimum();
+            x.Detach();
+        } catch (const std::bad_cast &e) {
+            throw WrongHeapTypeException();
+        }
+    }
+
+    template<class Key>
+    size_t RootTableBinomialHeap<Key>::Size() {
+        return size_;
+    }
+
+    template<class Key>
+    bool RootTableBinomialHeap<Key>::Empty() {
+        return size_ == 0;
+    }
+
+    template<class Key>
+    void RootTableBinomialHeap<Key>::Detach() {
+        occupied_ = 0;
+        minimal_degree_ = 0;
+        size_ = 0;
+    }
+
+    template<class Key>
+    template<class Callback>
+    void RootTableBinomialHeap<Key>::TakeKeys(Callback &&callback) {
+        for (uint64_t bits = occupied_; bits != 0; bits &= bits - 1) {
+            BinomialHeapNode<Key>::TakeKeys(roots_[__builtin_ctzll(bits)], callback);
+        }
+        Detach();
+    }
+
+    template<class Key>
+    std::vector<Key> RootTableBinomialHeap<Key>::Data() {
+        std::vector<Key> data;
+        for (uint64_t bits = occupied_; bits != 0; bits &= bits - 1) {
+            roots_[__builtin_ctzll(bits)]->CollectData(data);
+        }
+        std::sort(data.begin(), data.end());
+        return data;
+    }
+
+    // Destructor
+    template<class Key>
+    RootTableBinomialHeap<Key>::~RootTableBinomialHeap() {
+        for (uint64_t bits = occupied_; bits != 0; bits &= bits - 1) {
+            delete roots_[__builtin_ctzll(bits)];
+        }
+    }
+
+    // Copy constructor
+    template<class Key>
+    RootTableBinomialHeap<Key>::RootTableBinomialHeap(const RootTableBinomialHeap<Key> &other) :
+            occupied_(other.occupied_), minimal_degree_(other.minimal_degree_), size_(other.size_) {
+        for (uint64_t bits = occupied_; bits != 0; bits &= bits - 1) {
+            auto degree = static_cast<size_t>(__builtin_ctzll(bits));
+            roots_[degree] = new BinomialHeapNode<Key>(*other.roots_[degree]);
+        }
+    }
+
+    // Move constructor
+    template<class Key>
+    RootTableBinomialHeap<Key>::RootTableBinomialHeap(RootTableBinomialHeap<Key> &&other) noexcept :
+            RootTableBinomialHeap() {
+        Swap(other);
+    }
+
+    // Copy assignment operator
+    template<class Key>
+    RootTableBinomialHeap<Key> &RootTableBinomialHeap<Key>::operator=(const RootTableBinomialHeap<Key> &other) {
+        if (this != &other) {
+            RootTableBinomialHeap tmp(other);
+            Swap(tmp);
+        }
+        return *this;
+    }
+
+    // Move assignment operator
+    template<class Key>
+    RootTableBinomialHeap<Key> &RootTableBinomialHeap<Key>::operator=(RootTableBinomialHeap<Key> &&other) noexcept {
+        if (this != &other) {
+            RootTableBinomialHeap tmp(std::move(other));
+            Swap(tmp);
+        }
+        return *this;
+    }
+
+    template<class Key>
+    void RootTableBinomialHeap<Key>::Swap(RootTableBinomialHeap<Key> &x) noexcept {
+        std::swap(roots_, x.roots_);
+        std::swap(occupied_, x.occupied_);
+        std::swap(minimal_degree_, x.minimal_degree_);
+        std::swap(size_, x.size_);
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_ROOT_TABLE_BINOMIAL_H
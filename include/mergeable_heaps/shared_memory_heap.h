@@ -0,0 +1,578 @@
+#ifndef MERGEABLE_HEAPS_SHARED_MEMORY_HEAP_H
+#define MERGEABLE_HEAPS_SHARED_MEMORY_HEAP_H
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "heap_interface.h"
+#include "exceptions.h"
+#include "leftist_heap.h"
+#include "skew_heap.h"
+
+namespace heaps {
+    namespace detail {
+        // Mapping of a POSIX shared memory object, unmapped with the last heap using it.
+        class SharedMapping {
+        public:
+            SharedMapping(void *data, size_t size) : data_(data), size_(size) {}
+
+            ~SharedMapping() {
+                munmap(data_, size_);
+            }
+
+            SharedMapping(const SharedMapping &) = delete;
+
+            SharedMapping &operator=(const SharedMapping &) = delete;
+
+            char *Data() const {
+                return static_cast<char *>(data_);
+            }
+
+        private:
+            void *data_;
+            size_t size_;
+        };
+
+        [[noreturn]] inline void ThrowSystemError(int error, const char *what) {
+            throw std::system_error(error, std::generic_category(), what);
+        }
+    } // namespace detail
+
+    // Leftist or skew heap, which lives in a POSIX shared memory segment, so several processes
+    // may insert, extract and meld in place. Heap is LeftistHeap or SkewHeap and selects the merge.
+    // A segment holds a fixed pool of nodes and a fixed number of heaps, the nodes link by their
+    // indices in the pool, so every process may map the segment at its own address.
+    // All the heaps of a segment share one robust process-shared mutex. If a process dies holding it,
+    // the next one gets the lock; if the process died in the middle of a change, the segment is marked
+    // corrupted and every operation throws CorruptedSharedHeapException.
+    // SharedMemoryHeap is a handle: the keys stay in the segment, when it's destroyed.
+    template<class Key, template<class> class Heap = LeftistHeap>
+    class SharedMemoryHeap : public HeapInterface<Key> {
+        static_assert(std::is_trivially_copyable_v<Key>, "Keys are shared between the processes as bytes");
+
+        static constexpr bool kSkew = std::is_same_v<Heap<Key>, SkewHeap<Key>>;
+        static_assert(kSkew || std::is_same_v<Heap<Key>, LeftistHeap<Key>>, "Heap is LeftistHeap or SkewHeap");
+
+    public:
+        // Creates the shared memory object with room for capacity keys in heaps_cnt heaps
+        // and returns the first heap. Throws std::system_error, if the object exists or can't be mapped,
+        // SharedHeapLayoutException, if capacity doesn't fit into 32-bit indices or heaps_cnt is 0
+        static SharedMemoryHeap Create(const std::string &name, size_t capacity, size_t heaps_cnt = 1);
+
+        // Maps the shared memory object made by Create and returns its heap number index.
+        // Throws std::system_error, if there is no such object,
+        // SharedHeapLayoutException, if it holds other keys or has no such heap
+        static SharedMemoryHeap Open(const std::string &name, size_t index = 0);
+
+        // Removes the name of the shared memory object. The segment lives while it's mapped.
+        static void Unlink(const std::string &name);
+
+        // Returns the heap number index of the same segment.
+        // Throws SharedHeapLayoutException, if there is no such heap
+        SharedMemoryHeap Sibling(size_t index) const;
+
+        // Number of the heap in the segment
+        size_t Index() const;
+
+        // Number of the heaps in the segment
+        size_t HeapsCount() const;
+
+        // Maximal number of keys in all the heaps of the segment
+        size_t Capacity() const;
+
+        // Inserts an item into the heap
+        // Throws SharedHeapFullException, if the segment has no free nodes
+        void Insert(Key x) override;
+
+        // Return the minimal item in heap.
+        // Throws EmptyHeapException, if there is none
+        Key GetMinimum() override;
+
+        // Extracts minimal item from the heap
+        // Throws EmptyHeapException, if there is none
+        void ExtractMinimum() override;
+
+        // Extracts the minimal item and returns it, std::nullopt if there is none.
+        // Unlike GetMinimum with ExtractMinimum, no other process can take the item in between.
+        std::optional<Key> TakeMinimum();
+
+        // Melds the heap x of the same segment into *this in place.
+        // Throws WrongHeapTypeException, if x is not a SharedMemoryHeap of the same segment
+        void Merge(HeapInterface<Key> &x) override;
+
+        // Return number of items in the heap
+        size_t Size() override;
+
+        // Checks if the heap is empty
+        bool Empty() override;
+
+        // Detaches heap from its nodes without returning them to the segment
+        void Detach() override;
+
+        // Makes the heap empty and returns its nodes to the segment. O(n)
+        void Clear();
+
+        // Returns sorted std::vector with all the keys from the heap.
+        // Mainly for debug purposes.
+        std::vector<Key> Data();
+
+        // The handles are moved, copies of the heap would need nodes of the segment.
+        SharedMemoryHeap(const SharedMemoryHeap &other) = delete;
+
+        SharedMemoryHeap(SharedMemoryHeap &&other) noexcept = default;
+
+        SharedMemoryHeap &operator=(const SharedMemoryHeap &other) = delete;
+
+        SharedMemoryHeap &operator=(SharedMemoryHeap &&other) noexcept = default;
+
+        ~SharedMemoryHeap() override = default;
+
+    private:
+        // Index of the node in the pool. 0 is nullptr.
+        using Offset = uint32_t;
+
+        struct Node {
+            Key key_;
+            Offset child_left_;
+            Offset child_right_;
+            // Length of the right path, leftist heaps only
+            uint32_t rank_;
+        };
+
+        struct Slot {
+            Offset root_;
+            size_t size_;
+        };
+
+        struct Header {
+            uint64_t magic_;
+            uint64_t layout_;
+            // Tells the segments apart, when they are mapped at the different addresses
+            uint64_t segment_id_;
+            size_t capacity_;
+            size_t heaps_cnt_;
+            pthread_mutex_t mutex_;
+            // List of the free nodes linked by child_left_
+            Offset free_;
+            // First node, which was never used
+            Offset fresh_;
+            // Set while the heaps are changed under the lock
+            bool changing_;
+            bool corrupted_;
+        };
+
+        static constexpr uint64_t kMagic = 0x4d48454150534d31ULL;
+        static constexpr uint64_t kLayout = (uint64_t(sizeof(Key)) << 32) | (uint64_t(alignof(Key)) << 1) | kSkew;
+
+        // Holds the mutex of the segment
+        class Lock {
+        public:
+            explicit Lock(Header *header);
+
+            ~Lock();
+
+            Lock(const Lock &) = delete;
+
+            Lock &operator=(const Lock &) = delete;
+
+        private:
+            Header *header_;
+        };
+
+        std::shared_ptr<detail::SharedMapping> mapping_;
+        Header *header_;
+        Slot *slot_;
+        // nodes_[0] is never used
+        Node *nodes_;
+        size_t index_;
+
+        SharedMemoryHeap(std::shared_ptr<detail::SharedMapping> mapping, size_t index);
+
+        static size_t SlotsOffset();
+
+        static size_t NodesOffset(size_t heaps_cnt);
+
+        static size_t SegmentBytes(size_t capacity, size_t heaps_cnt);
+
+        uint32_t Rank(Offset v) const;
+
+        // Melds the trees with the roots a and b. Allocates nothing, so it's never interrupted by an exception.
+        Offset Meld(Offset a, Offset b);
+
+        // Removes the root of the non-empty heap and frees its node. Called under the lock.
+        void ExtractRoot();
+    };
+
+    template<class Key, template<class> class Heap>
+    SharedMemoryHeap<Key, Heap>::Lock::Lock(Header *header) : header_(header) {
+        const int result = pthread_mutex_lock(&header_->mutex_);
+        if (result == EOWNERDEAD) {
+            if (header_->changing_) {
+                header_->corrupted_ = true;
+            }
+            pthread_mutex_consistent(&header_->mutex_);
+        } else if (result != 0) {
+            detail::ThrowSystemError(result, "pthread_mutex_lock");
+        }
+        if (header_->corrupted_) {
+            pthread_mutex_unlock(&header_->mutex_);
+            throw CorruptedSharedHeapException();
+        }
+    }
+
+    template<class Key, template<class> class Heap>
+    SharedMemoryHeap<Key, Heap>::Lock::~Lock() {
+        pthread_mutex_unlock(&header_->mutex_);
+    }
+
+    template<class Key, template<class> class Heap>
+    SharedMemoryHeap<Key, Heap>::SharedMemoryHeap(std::shared_ptr<detail::SharedMapping> mapping, size_t index)
+            : mapping_(std::move(mapping)), index_(index) {
+        header_ = reinterpret_cast<Header *>(mapping_->Data());
+        slot_ = reinterpret_cast<Slot *>(mapping_->Data() + SlotsOffset()) + index;
+        nodes_ = reinterpret_cast<Node *>(mapping_->Data() + NodesOffset(header_->heaps_cnt_));
+    }
+
+    template<class Key, template<class> class Heap>
+    size_t SharedMemoryHeap<Key, Heap>::SlotsOffset() {
+        return (sizeof(Header) + alignof(Slot) - 1) / alignof(Slot) * alignof(Slot);
+    }
+
+    template<class Key, template<class> class Heap>
+    size_t SharedMemoryHeap<Key, Heap>::NodesOffset(size_t heaps_cnt) {
+        const size_t slots_end = SlotsOffset() + heaps_cnt * sizeof(Slot);
+        return (slots_end + alignof(Node) - 1) / alignof(Node) * alignof(Node);
+    }
+
+    template<class Key, template<class> class Heap>
+    size_t SharedMemoryHeap<Key, Heap>::SegmentBytes(size_t capacity, size_t heaps_cnt) {
+        return NodesOffset(heaps_cnt) + (capacity + 1) * sizeof(Node);
+    }
+
+    template<class Key, template<class> class Heap>
+    SharedMemoryHeap<Key, Heap> SharedMemoryHeap<Key, Heap>::Create(const std::string &name, size_t capacity,
+                                                                    size_t heaps_cnt) {
+        if (capacity >= UINT32_MAX || heaps_cnt == 0) {
+            throw SharedHeapLayoutException();
+        }
+        const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0) {
+            detail::ThrowSystemError(errno, "shm_open");
+        }
+        const size_t bytes = SegmentBytes(capacity, heaps_cnt);
+        void *data = MAP_FAILED;
+        const char *failed = "ftruncate";
+        int error = 0;
+        if (ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+            error = errno;
+        } else if ((data = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)) == MAP_FAILED) {
+            failed = "mmap";
+            error = errno;
+        }
+        close(fd);
+        if (data == MAP_FAILED) {
+            shm_unlink(name.c_str());
+            detail::ThrowSystemError(error, failed);
+        }
+        auto mapping = std::make_shared<detail::SharedMapping>(data, bytes);
+        auto *header = new(data) Header();
+        pthread_mutexattr_t attributes;
+        pthread_mutexattr_init(&attributes);
+        pthread_mutexattr_setpshared(&attributes, PTHREAD_PROCESS_SHARED);
+        pthread_mutexattr_setrobust(&attributes, PTHREAD_MUTEX_ROBUST);
+        pthread_mutex_init(&header->mutex_, &attributes);
+        pthread_mutexattr_destroy(&attributes);
+        header->layout_ = kLayout;
+        header->segment_id_ = (static_cast<uint64_t>(getpid()) << 32) ^ static_cast<uint64_t>(
+                std::chrono::steady_clock::now().time_since_epoch().count());
+        header->capacity_ = capacity;
+        header->heaps_cnt_ = heaps_cnt;
+        header->free_ = 0;
+        header->fresh_ = 1;
+        header->changing_ = false;
+        header->corrupted_ = false;
+        for (size_t i = 0; i < heaps_cnt; ++i) {
+            new(mapping->Data() + SlotsOffset() + i * sizeof(Slot)) Slot{0, 0};
+        }
+        header->magic_ = kMagic;
+        return SharedMemoryHeap(std::move(mapping), 0);
+    }
+
+    template<class Key, template<class> class Heap>
+    SharedMemoryHeap<Key, Heap> SharedMemoryHeap<Key, Heap>::Open(const std::string &name, size_t index) {
+        const int fd = shm_open(name.c_str(), O_RDWR, 0);
+        if (fd < 0) {
+            detail::ThrowSystemError(errno, "shm_open");
+        }
+        struct stat status{};
+        if (fstat(fd, &status) != 0) {
+            const int error = errno;
+            close(fd);
+            detail::ThrowSystemError(error, "fstat");
+        }
+        const auto bytes = static_cast<size_t>(status.st_size);
+        if (bytes < sizeof(Header)) {
+            close(fd);
+            throw SharedHeapLayoutException();
+        }
+        void *data = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        const int error = errno;
+        close(fd);
+        if (data == MAP_FAILED) {
+            detail::ThrowSystemError(error, "mmap");
+        }
+        auto mapping = std::make_shared<detail::SharedMapping>(data, bytes);
+        const auto *header = reinterpret_cast<const Header *>(data);
+        if (header->magic_ != kMagic || header->layout_ != kLayout ||
+            bytes != SegmentBytes(header->capacity_, header->heaps_cnt_) || index >= header->heaps_cnt_) {
+            throw SharedHeapLayoutException();
+        }
+        return SharedMemoryHeap(std::move(mapping), index);
+    }
+
+    template<class Key, template<class> class Heap>
+    void SharedMemoryHeap<Key, Heap>::Unlink(const std::string &name) {
+        if (shm_unlink(name.c_str()) != 0) {
+            detail::ThrowSystemError(errno, "shm_unlink");
+        }
+    }
+
+    template<class Key, template<class> class Heap>
+    SharedMemoryHeap<Key, Heap> SharedMemoryHeap<Key, Heap>::Sibling(size_t index) const {
+        if (index >= header_->heaps_cnt_) {
+            throw SharedHeapLayoutException();
+        }
+        return SharedMemoryHeap(mapping_, index);
+    }
+
+    template<class Key, template<class> class Heap>
+    size_t SharedMemoryHeap<Key, Heap>::Index() const {
+        return index_;
+    }
+
+    template<class Key, template<class> class Heap>
+    size_t SharedMemoryHeap<Key, Heap>::HeapsCount() const {
+        return header_->heaps_cnt_;
+    }
+
+    template<class Key, template<class> class Heap>
+    size_t SharedMemoryHeap<Key, Heap>::Capacity() const {
+        return header_->capacity_;
+    }
+
+    template<class Key, template<class> class Heap>
+    uint32_t SharedMemoryHeap<Key, Heap>::Rank(Offset v) const {
+        return v == 0 ? 0 : nodes_[v].rank_;
+    }
+
+    template<class Key, template<class> class Heap>
+    typename SharedMemoryHeap<Key, Heap>::Offset SharedMemoryHeap<Key, Heap>::Meld(Offset a, Offset b) {
+        Offset root = 0;
+        Offset *slot = &root;
+        if constexpr (kSkew) {
+            // Top-down skew merge: the merged rest becomes the left child, the old left child goes right.
+            while (a != 0 && b != 0) {
+                if (nodes_[b].key_ < nodes_[a].key_) {
+                    std::swap(a, b);
+                }
+                Node &v = nodes_[a];
+                *slot = a;
+                a = v.child_right_;
+                v.child_right_ = v.child_left_;
+                slot = &v.child_left_;
+            }
+            *slot = a != 0 ? a : b;
+        } else {
+            // Right paths of the leftist trees with less than 2^32 nodes are at most 32 long.
+            std::array<Offset, 64> path{};
+            size_t depth = 0;
+            while (a != 0 && b != 0) {
+                if (nodes_[b].key_ < nodes_[a].key_) {
+                    std::swap(a, b);
+                }
+                path[depth++] = a;
+                *slot = a;
+                slot = &nodes_[a].child_right_;
+                a = nodes_[a].child_right_;
+            }
+            *slot = a != 0 ? a : b;
+            while (depth > 0) {
+                Node &v = nodes_[path[--depth]];
+                if (Rank(v.child_left_) < Rank(v.child_right_)) {
+                    std::swap(v.child_left_, v.child_right_);
+                }
+                v.rank_ = Rank(v.child_right_) + 1;
+            }
+        }
+        return root;
+    }
+
+    template<class Key, template<class> class Heap>
+    void SharedMemoryHeap<Key, Heap>::ExtractRoot() {
+        const Offset root = slot_->root_;
+        header_->changing_ = true;
+        slot_->root_ = Meld(nodes_[root].child_left_, nodes_[root].child_right_);
+        --slot_->size_;
+        nodes_[root].child_left_ = header_->free_;
+        header_->free_ = root;
+        header_->changing_ = false;
+    }
+
+    template<class Key, template<class> class Heap>
+    void SharedMemoryHeap<Key, Heap>::Insert(Key x) {
+        Lock lock(header_);
+        Offset v;
+        if (header_->free_ != 0) {
+            v = header_->free_;
+            header_->free_ = nodes_[v].child_left_;
+        } else if (header_->fresh_ <= header_->capacity_) {
+            v = header_->fresh_++;
+        } else {
+            throw SharedHeapFullException();
+        }
+        nodes_[v] = Node{x, 0, 0, 1};
+        header_->changing_ = true;
+        slot_->root_ = Meld(slot_->root_, v);
+        ++slot_->size_;
+        header_->changing_ = false;
+    }
+
+    template<class Key, template<class> class Heap>
+    Key SharedMemoryHeap<Key, Heap>::GetMinimum() {
+        Lock lock(header_);
+        if (slot_->root_ == 0) {
+            throw EmptyHeapException();
+        }
+        return nodes_[slot_->root_].key_;
+    }
+
+    template<class Key, template<class> class Heap>
+    void SharedMemoryHeap<Key, Heap>::ExtractMinimum() {
+        Lock lock(header_);
+        if (slot_->root_ == 0) {
+            throw EmptyHeapException();
+        }
+        ExtractRoot();
+    }
+
+    template<class Key, template<class> class Heap>
+    std::optional<Key> SharedMemoryHeap<Key, Heap>::TakeMinimum() {
+        Lock lock(header_);
+        if (slot_->root_ == 0) {
+            return std::nullopt;
+        }
+        const Key key = nodes_[slot_->root_].key_;
+        ExtractRoot();
+        return key;
+    }
+
+    template<class Key, template<class> class Heap>
+    void SharedMemoryHeap<Key, Heap>::Merge(HeapInterface<Key> &x) {
+        if (&x == this) {
+            throw SelfHeapMergeException();
+        }
+        try {
+            auto &casted = dynamic_cast<SharedMemoryHeap<Key, Heap> &>(x);
+            if (casted.header_->segment_id_ != header_->segment_id_) {
+                throw WrongHeapTypeException();
+            }
+            if (casted.index_ == index_) {
+                throw SelfHeapMergeException();
+            }
+            // x is detached under the same lock, so no process sees the keys in the both heaps.
+            Lock lock(header_);
+            header_->changing_ = true;
+            slot_->root_ = Meld(slot_->root_, casted.slot_->root_);
+            slot_->size_ += casted.slot_->size_;
+            casted.slot_->root_ = 0;
+            casted.slot_->size_ = 0;
+            header_->changing_ = false;
+        } catch (const std::bad_cast &e) {
+            throw WrongHeapTypeException();
+        }
+    }
+
+    template<class Key, template<class> class Heap>
+    size_t SharedMemoryHeap<Key, Heap>::Size() {
+        Lock lock(header_);
+        return slot_->size_;
+    }
+
+    template<class Key, template<class> class Heap>
+    bool SharedMemoryHeap<Key, Heap>::Empty() {
+        Lock lock(header_);
+        return slot_->root_ == 0;
+    }
+
+    template<class Key, template<class> class Heap>
+    void SharedMemoryHeap<Key, Heap>::Detach() {
+        Lock lock(header_);
+        slot_->root_ = 0;
+        slot_->size_ = 0;
+    }
+
+    template<class Key, template<class> class Heap>
+    void SharedMemoryHeap<Key, Heap>::Clear() {
+        Lock lock(header_);
+        header_->changing_ = true;
+        // Rotates the left children up, so the tree is freed without a stack.
+        Offset v = slot_->root_;
+        while (v != 0) {
+            Node &node = nodes_[v];
+            if (node.child_left_ != 0) {
+                const Offset left = node.child_left_;
+                node.child_left_ = nodes_[left].child_right_;
+                nodes_[left].child_right_ = v;
+                v = left;
+            } else {
+                const Offset next = node.child_right_;
+                node.child_left_ = header_->free_;
+                header_->free_ = v;
+                v = next;
+            }
+        }
+        slot_->root_ = 0;
+        slot_->size_ = 0;
+        header_->changing_ = false;
+    }
+
+    template<class Key, template<class> class Heap>
+    std::vector<Key> SharedMemoryHeap<Key, Heap>::Data() {
+        Lock lock(header_);
+        std::vector<Key> data;
+        data.reserve(slot_->size_);
+        std::vector<Offset> stack;
+        if (slot_->root_ != 0) {
+            stack.push_back(slot_->root_);
+        }
+        while (!stack.empty()) {
+            const Node &v = nodes_[stack.back()];
+            stack.pop_back();
+            data.push_back(v.key_);
+            for (Offset child: {v.child_left_, v.child_right_}) {
+                if (child != 0) {
+                    stack.push_back(child);
+                }
+            }
+        }
+        std::sort(data.begin(), data.end());
+        return data;
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_SHARED_MEMORY_HEAP_H
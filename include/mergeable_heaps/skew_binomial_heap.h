@@ -0,0 +1,384 @@
+#ifndef MERGEABLE_HEAPS_SKEW_BINOMIAL_H
+#define MERGEABLE_HEAPS_SKEW_BINOMIAL_H
+
+#include <array>
+#include <vector>
+#include <algorithm>
+#include "heap_interface.h"
+#include "exceptions.h"
+#include "nodes/binomial_heap_node.h"
+
+namespace heaps {
+    // Skew Binomial Heap implementation (Brodal and Okasaki). Key is the type of data stored.
+    // The ranks of the trees follow the skew binary numbers: only the two smallest trees may have the same rank,
+    // so Insert does at most one skew link of the new node with them and never propagates a carry.
+    // The minimal key is kept out of the trees in a separate node, the global root.
+    // Insert and GetMinimum are O(1) in the worst case, Merge and ExtractMinimum are O(log n).
+    template<class Key>
+    class SkewBinomialHeap : public HeapInterface<Key> {
+    private:
+        // A tree of rank r has at least 2^r nodes.
+        static constexpr size_t kMaxRank = 64;
+
+        // Node with the minimal key, it has no children. If the heap is empty, nullptr.
+        BinomialHeapNode<Key> *minimal_;
+        // List of roots, linked by sibling_, in the non-decreasing order of ranks. degree_ of a node is its rank.
+        // Only the first two ranks may be equal.
+        BinomialHeapNode<Key> *roots_;
+        // Number of items in the heap
+        size_t size_;
+
+        // Links two trees of the same rank r into a tree of rank r + 1. The one with the smaller key becomes the root.
+        static BinomialHeapNode<Key> *Link(BinomialHeapNode<Key> *v1, BinomialHeapNode<Key> *v2);
+
+        // Links the single node v and two trees of the same rank r into a tree of rank r + 1.
+        // Either v becomes the root over both trees, or v is added as a child of rank 0 to their link.
+        static BinomialHeapNode<Key> *SkewLink(BinomialHeapNode<Key> *v, BinomialHeapNode<Key> *v1,
+                                               BinomialHeapNode<Key> *v2);
+
+        // Adds the single node to the trees. O(1)
+        void InsertNode(BinomialHeapNode<Key> *v);
+
+        // Links the trees of the list into the roots_, so that all the ranks are distinct. O(log n)
+        void MeldTrees(BinomialHeapNode<Key> *list);
+
+        // Deletes all the nodes.
+        void Clear();
+
+    public:
+        // Size of one node of the trees in bytes
+        static constexpr size_t kNodeBytes = sizeof(BinomialHeapNode<Key>);
+
+        // Constructor for empty heap
+        SkewBinomialHeap();
+
+        // Constructor for one-item heap
+        explicit SkewBinomialHeap(Key key);
+
+        // Inserts an item into the heap. O(1) in the worst case
+        void Insert(Key x) override;
+
+        // Return the minimal item in heap. O(1)
+        // Throws EmptyHeapException, if there is none
+        Key GetMinimum() override;
+
+        // Extracts minimal item from the heap. The smallest root replaces the global root. O(log n)
+        // Throws EmptyHeapException, if there is none
+        void ExtractMinimum() override;
+
+        // Merges an abstract heap into *this. O(log n)
+        // Throws WrongHeapTypeException, if x is not a SkewBinomialHeap
+        void Merge(HeapInterface<Key> &x) override;
+
+        // Return number of items in the heap
+        size_t Size() override;
+
+        // Checks if the heap is empty
+        bool Empty() override;
+
+        // Detaches heap from its nodes without deleting them
+        // Now, it's user's responsibility to free node's memory.
+        void Detach() override;
+
+        // Passes all the keys to callback in no particular order and deletes the nodes on the way.
+        // The heap becomes empty. O(n)
+        template<class Callback>
+        void TakeKeys(Callback &&callback);
+
+        // Returns sorted std::vector with all the keys from the heap.
+        // Mainly for debug purposes.
+        std::vector<Key> Data();
+
+        //
+        // Rule of Five functions
+        //
+
+        // Destructor. Destructs the heap with all it's nodes
+        // Unless they are detached.
+        ~SkewBinomialHeap();
+
+        // Copy constructor. Creates the copy of the heap and all it's nodes
+        SkewBinomialHeap(const SkewBinomialHeap &other);
+
+        // Move constructor. Creates the copy of the heap by stealing resources.
+        // Other heap is left as newly initialized.
+        SkewBinomialHeap(SkewBinomialHeap &&other) noexcept;
+
+        // Copy assignment operator
+        SkewBinomialHeap &operator=(const SkewBinomialHeap &other);
+
+        // Move assignment operator
+        SkewBinomialHeap &operator=(SkewBinomialHeap &&other) noexcept;
+
+        // Swap function for "Copy and Swap" idiom
+        void Swap(SkewBinomialHeap &x) noexcept;
+    };
+
+    template<class Key>
+    SkewBinomialHeap<Key>::SkewBinomialHeap() : minimal_(nullptr), roots_(nullptr), size_(0) {}
+
+    template<class Key>
+    SkewBinomialHeap<Key>::SkewBinomialHeap(Key key) : SkewBinomialHeap() {
+        Insert(key);
+    }
+
+    template<class Key>
+    BinomialHeapNode<Key> *SkewBinomialHeap<Key>::Link(BinomialHeapNode<Key> *v1, BinomialHeapNode<Key> *v2) {
+        if (v2->key_ < v1->key_) {
+            std::swap(v1, v2);
+        }
+        v1->Merge_(v2);
+        return v1;
+    }
+
+    template<class Key>
+    BinomialHeapNode<Key> *SkewBinomialHeap<Key>::SkewLink(BinomialHeapNode<Key> *v, BinomialHeapNode<Key> *v1,
+                                                           BinomialHeapNode<Key> *v2) {
+        if (v->key_ < v1->key_ && v->key_ < v2->key_) {
+            const size_t rank = v1->degree_ + 1;
+            v->Merge_(v1);
+            v->Merge_(v2);
+            v->degree_ = rank;
+            return v;
+        }
+        BinomialHeapNode<Key> *root = Link(v1, v2);
+        root->Merge_(v);
+        // The rank-0 child doesn't raise the rank.
+        --root->degree_;
+        return root;
+    }
+
+    template<class Key>
+    void SkewBinomialHeap<Key>::InsertNode(BinomialHeapNode<Key> *v) {
+        BinomialHeapNode<Key> *first = roots_;
+        BinomialHeapNode<Key> *second = first == nullptr ? nullptr : first->sibling_;
+        if (second != nullptr && first->degree_ == second->degree_) {
+            BinomialHeapNode<Key> *rest = second->sibling_;
+            first->sibling_ = second->sibling_ = nullptr;
+            v = SkewLink(v, first, second);
+            v->sibling_ = rest;
+        } else {
+            v->sibling_ = roots_;
+        }
+        roots_ = v;
+    }
+
+    template<class Key>
+    void SkewBinomialHeap<Key>::MeldTrees(BinomialHeapNode<Key> *list) {
+        // trees[r] is the only tree of rank r found so far, linked like the ones of a binary counter.
+        std::array<BinomialHeapNode<Key> *, kMaxRank> trees{};
+        size_t max_rank = 0;
+        for (BinomialHeapNode<Key> *i: {roots_, list}) {
+            while (i != nullptr) {
+                BinomialHeapNode<Key> *v = i;
+                i = i->sibling_;
+                v->sibling_ = nullptr;
+                v->parent_ = nullptr;
+                while (trees[v->degree_] != nullptr) {
+                    BinomialHeapNode<Key> *other = trees[v->degree_];
+                    trees[v->degree_] = nullptr;
+                    v = Link(other, v);
+                }
+                trees[v->degree_] = v;
+                max_rank = std::max(max_rank, v->degree_);
+            }
+        }
+        roots_ = nullptr;
+        for (size_t rank = max_rank + 1; rank-- > 0;) {
+            if (trees[rank] != nullptr) {
+                trees[rank]->sibling_ = roots_;
+                roots_ = trees[rank];
+            }
+        }
+    }
+
+    template<class Key>
+    void SkewBinomialHeap<Key>::Insert(Key x) {
+        auto *v = new BinomialHeapNode<Key>(x, nullptr, nullptr, nullptr, 0u);
+        ++size_;
+        if (minimal_ == nullptr) {
+            minimal_ = v;
+            return;
+        }
+        if (v->key_ < minimal_->key_) {
+            std::swap(v, minimal_);
+        }
+        InsertNode(v);
+    }
+
+    template<class Key>
+    Key SkewBinomialHeap<Key>::GetMinimum() {
+        if (Empty()) {
+            throw EmptyHeapException();
+        }
+        return minimal_->key_;
+    }
+
+    template<class Key>
+    void SkewBinomialHeap<Key>::ExtractMinimum() {
+        if (Empty()) {
+            throw EmptyHeapException();
+        }
+        delete minimal_;
+        minimal_ = nullptr;
+        --size_;
+        if (roots_ == nullptr) {
+            return;
+        }
+        BinomialHeapNode<Key> *predecessor = nullptr;
+        BinomialHeapNode<Key> *minimal_predecessor = nullptr;
+        BinomialHeapNode<Key> *minimal_root = roots_;
+        for (BinomialHeapNode<Key> *i = roots_; i != nullptr; predecessor = i, i = i->sibling_) {
+            if (i->key_ < minimal_root->key_) {
+                minimal_root = i;
+                minimal_predecessor = predecessor;
+            }
+        }
+        if (minimal_predecessor == nullptr) {
+            roots_ = minimal_root->sibling_;
+        } else {
+            minimal_predecessor->sibling_ = minimal_root->sibling_;
+        }
+        // Children of the rank 0 are single nodes added by the skew links, they are inserted back in O(1).
+        // The others are melded with the remaining roots.
+        BinomialHeapNode<Key> *children = nullptr;
+        for (BinomialHeapNode<Key> *i = minimal_root->child_; i != nullptr;) {
+            BinomialHeapNode<Key> *next = i->sibling_;
+            i->parent_ = nullptr;
+            if (i->degree_ == 0) {
+                i->sibling_ = nullptr;
+                InsertNode(i);
+            } else {
+                i->sibling_ = children;
+                children = i;
+            }
+            i = next;
+        }
+        if (children != nullptr) {
+            MeldTrees(children);
+        }
+        minimal_root->Detach();
+        minimal_root->degree_ = 0;
+        minimal_ = minimal_root;
+    }
+
+    template<class Key>
+    void SkewBinomialHeap<Key>::Merge(HeapInterface<Key> &x) {
+        if (&x == this) {
+            throw SelfHeapMergeException();
+        }
+        try {
+            auto &casted = dynamic_cast<SkewBinomialHeap<Key> &>(x);
+            if (casted.minimal_ != nullptr) {
+                if (casted.roots_ != nullptr) {
+                    MeldTrees(casted.roots_);
+                }
+                BinomialHeapNode<Key> *v = casted.minimal_;
+                if (minimal_ == nullptr) {
+                    minimal_ = v;
+                } else {
+                    if (v->key_ < minimal_->key_) {
+                        std::swap(v, minimal_);
+                    }
+                    InsertNode(v);
+                }
+            }
+            size_ += casted.size_;
+            x.Detach();
+        } catch (const std::bad_cast &e) {
+            throw WrongHeapTypeException();
+        }
+    }
+
+    template<class Key>
+    size_t SkewBinomialHeap<Key>::Size() {
+        return size_;
+    }
+
+    template<class Key>
+    bool SkewBinomialHeap<Key>::Empty() {
+        return minimal_ == nullptr;
+    }
+
+    template<class Key>
+    void SkewBinomialHeap<Key>::Detach() {
+        minimal_ = roots_ = nullptr;
+        size_ = 0;
+    }
+
+    template<class Key>
+    template<class Callback>
+    void SkewBinomialHeap<Key>::TakeKeys(Callback &&callback) {
+        BinomialHeapNode<Key>::TakeKeys(minimal_, callback);
+        BinomialHeapNode<Key>::TakeKeys(roots_, callback);
+        Detach();
+    }
+
+    template<class Key>
+    std::vector<Key> SkewBinomialHeap<Key>::Data() {
+        std::vector<Key> data;
+        data.reserve(size_);
+        for (BinomialHeapNode<Key> *v: {minimal_, roots_}) {
+            if (v != nullptr) {
+                v->CollectData(data);
+            }
+        }
+        std::sort(data.begin(), data.end());
+        return data;
+    }
+
+    template<class Key>
+    void SkewBinomialHeap<Key>::Clear() {
+        delete minimal_;
+        delete roots_;
+        Detach();
+    }
+
+    // Destructor
+    template<class Key>
+    SkewBinomialHeap<Key>::~SkewBinomialHeap() {
+        Clear();
+    }
+
+    // Copy constructor
+    template<class Key>
+    SkewBinomialHeap<Key>::SkewBinomialHeap(const SkewBinomialHeap &other) :
+            minimal_(other.minimal_ == nullptr ? nullptr : new BinomialHeapNode<Key>(*other.minimal_)),
+            roots_(other.roots_ == nullptr ? nullptr : new BinomialHeapNode<Key>(*other.roots_)),
+            size_(other.size_) {}
+
+    // Move constructor
+    template<class Key>
+    SkewBinomialHeap<Key>::SkewBinomialHeap(SkewBinomialHeap &&other) noexcept : SkewBinomialHeap() {
+        Swap(other);
+    }
+
+    // Copy assignment operator
+    template<class Key>
+    SkewBinomialHeap<Key> &SkewBinomialHeap<Key>::operator=(const SkewBinomialHeap &other) {
+        if (this != &other) {
+            SkewBinomialHeap tmp(other);
+            Swap(tmp);
+        }
+        return *this;
+    }
+
+    // Move assignment operator
+    template<class Key>
+    SkewBinomialHeap<Key> &SkewBinomialHeap<Key>::operator=(SkewBinomialHeap &&other) noexcept {
+        if (this != &other) {
+            SkewBinomialHeap tmp(std::move(other));
+            Swap(tmp);
+        }
+        return *this;
+    }
+
+    template<class Key>
+    void SkewBinomialHeap<Key>::Swap(SkewBinomialHeap &x) noexcept {
+        std::swap(minimal_, x.minimal_);
+        std::swap(roots_, x.roots_);
+        std::swap(size_, x.size_);
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_SKEW_BINOMIAL_H
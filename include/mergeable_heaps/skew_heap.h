@@ -8,19 +8,21 @@
 
 namespace heaps {
     // Skew Heap implementation. Key is the type of data stored
-    template<class Key = int>
-    class SkewHeap : public ClassicalHeap<Key, SkewHeapNode<Key>> {
-        using Base = ClassicalHeap<Key, SkewHeapNode<Key>>;
+    // Up to InlineCapacity keys are stored inline, without allocating the nodes.
+    // With BufferInserts the inserted keys are melded at once on the next extraction or merge.
+    template<class Key = int, size_t InlineCapacity = 0, bool BufferInserts = false>
+    class SkewHeap : public ClassicalHeap<Key, SkewHeapNode<Key>, InlineCapacity, BufferInserts> {
+        using Base = ClassicalHeap<Key, SkewHeapNode<Key>, InlineCapacity, BufferInserts>;
     public:
+        // Constructor for empty heap
+        SkewHeap() = default;
+
         // Constructor for one-item heap
         explicit SkewHeap(Key key);
     };
 
-    template<class Key>
-    SkewHeap<Key>::SkewHeap(Key key) {
-        Base::size_ = 1;
-        Base::root_ = new heaps::SkewHeapNode<Key>(key, nullptr, nullptr);
-    }
+    template<class Key, size_t InlineCapacity, bool BufferInserts>
+    SkewHeap<Key, InlineCapacity, BufferInserts>::SkewHeap(Key key) : Base(key) {}
 } // namespace heaps
 
 #endif // MERGEABLE_HEAPS_SKEW_H
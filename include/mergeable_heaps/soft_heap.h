@@ -0,0 +1,335 @@
+#ifndef MERGEABLE_HEAPS_SOFT_H
+#define MERGEABLE_HEAPS_SOFT_H
+
+#include <array>
+#include <cmath>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include "heap_interface.h"
+#include "exceptions.h"
+#include "nodes/soft_heap_node.h"
+
+namespace heaps {
+    // Soft Heap implementation (Kaplan, Tarjan, Zwick, "Soft heaps simplified").
+    // The heap may corrupt items, i.e. raise their keys, in exchange for speed:
+    // at most epsilon * (number of insertions) items are corrupted at any time.
+    // GetMinimum returns an item with the minimal current key, which may differ from the minimal item.
+    // Insert is amortized O(1), ExtractMinimum is amortized O(log(1 / epsilon)).
+    // With epsilon small enough for the rank bound to exceed any possible rank, the heap is exact.
+    template<class Key>
+    class SoftHeap : public HeapInterface<Key> {
+    private:
+        // Rank of a root can't exceed the number of bits in size_t.
+        static constexpr size_t kMaxRank = 64;
+
+        // roots_[i] is the root of rank i, valid only if i-th bit of occupied_ is set.
+        std::array<SoftHeapNode<Key> *, kMaxRank> roots_;
+        uint64_t occupied_;
+        // suffix_minimum_[i] is the rank of the root with the minimal key among roots of rank >= i.
+        // Valid for the occupied ranks.
+        std::array<size_t, kMaxRank> suffix_minimum_;
+        // Nodes with greater rank may corrupt items.
+        size_t corruption_rank_;
+        // Number of items in the heap
+        size_t size_;
+
+        // Recomputes suffix_minimum_ for the occupied ranks not greater than "rank".
+        void UpdateSuffixMinimums(size_t rank);
+
+        // Returns the root holding the item with the minimal current key.
+        SoftHeapNode<Key> *MinimalRoot();
+
+    public:
+        // Default error rate
+        static constexpr double kDefaultEpsilon = 1.0 / 8;
+
+        // Constructor for empty heap with the given error rate
+        explicit SoftHeap(double epsilon = kDefaultEpsilon);
+
+        // Constructor for one-item heap
+        explicit SoftHeap(Key key, double epsilon = kDefaultEpsilon);
+
+        // Inserts an item into the heap. Amortized O(1)
+        void Insert(Key x) override;
+
+        // Return the item with the minimal current key.
+        // Throws EmptyHeapException, if there is none
+        Key GetMinimum() override;
+
+        // Returns the minimal current key. It's not less than the item returned by GetMinimum.
+        // Throws EmptyHeapException, if there is none
+        Key GetMinimumCurrentKey();
+
+        // Returns true, if the item returned by GetMinimum is corrupted.
+        // Throws EmptyHeapException, if there is none
+        bool IsMinimumCorrupted();
+
+        // Extracts the item with the minimal current key.
+        // Throws EmptyHeapException, if there is none
+        void ExtractMinimum() override;
+
+        // Merges an abstract heap into *this. The error rate of *this is kept.
+        // Throws WrongHeapTypeException, if x is not a SoftHeap
+        void Merge(HeapInterface<Key> &x) override;
+
+        // Return number of items in the heap
+        size_t Size() override;
+
+        // Checks if the heap is empty
+        bool Empty() override;
+
+        // Detaches heap from its nodes without deleting them
+        // Now, it's user's responsibility to free node's memory.
+        void Detach() override;
+
+        // Returns sorted std::vector with all the items from the heap.
+        // Mainly for debug purposes.
+        std::vector<Key> Data();
+
+        // Returns all the corrupted items in the heap. O(n)
+        std::vector<Key> CorruptedItems();
+
+        //
+        // Rule of Five functions
+        //
+
+        // Destructor. Destructs the heap with all it's nodes
+        // Unless they are detached.
+        ~SoftHeap();
+
+        // Copy constructor. Creates the copy of the heap and all it's nodes
+        SoftHeap(const SoftHeap<Key> &other);
+
+        // Move constructor. Creates the copy of the heap by stealing resources.
+        // Other heap is left as newly initialized.
+        SoftHeap(SoftHeap<Key> &&other) noexcept;
+
+        // Copy assignment operator
+        SoftHeap<Key> &operator=(const SoftHeap<Key> &other);
+
+        // Move assignment operator
+        SoftHeap<Key> &operator=(SoftHeap<Key> &&other) noexcept;
+
+        // Swap function for "Copy and Swap" idiom
+        void Swap(SoftHeap<Key> &x) noexcept;
+    };
+
+    template<class Key>
+    SoftHeap<Key>::SoftHeap(double epsilon) : occupied_(0), size_(0) {
+        // With r = ceil(log2(1 / epsilon)) + 5 at most epsilon * n items are corrupted.
+        double bound = std::ceil(std::log2(1.0 / std::min(std::max(epsilon, 1e-18), 1.0))) + 5;
+        corruption_rank_ = static_cast<size_t>(std::min(bound, static_cast<double>(kMaxRank)));
+    }
+
+    template<class Key>
+    SoftHeap<Key>::SoftHeap(Key key, double epsilon) : SoftHeap(epsilon) {
+        Insert(key);
+    }
+
+    template<class Key>
+    void SoftHeap<Key>::UpdateSuffixMinimums(size_t rank) {
+        uint64_t above = rank + 1 < kMaxRank ? occupied_ >> (rank + 1) << (rank + 1) : 0;
+        size_t best = above == 0 ? kMaxRank : suffix_minimum_[__builtin_ctzll(above)];
+        uint64_t below = rank + 1 < kMaxRank ? occupied_ & ((uint64_t(1) << (rank + 1)) - 1) : occupied_;
+        while (below != 0) {
+            auto i = static_cast<size_t>(63 - __builtin_clzll(below));
+            below &= ~(uint64_t(1) << i);
+            if (best == kMaxRank || roots_[i]->key_ < roots_[best]->key_) {
+                best = i;
+            }
+            suffix_minimum_[i] = best;
+        }
+    }
+
+    template<class Key>
+    SoftHeapNode<Key> *SoftHeap<Key>::MinimalRoot() {
+        if (Empty()) {
+            throw EmptyHeapException();
+        }
+        return roots_[suffix_minimum_[__builtin_ctzll(occupied_)]];
+    }
+
+    template<class Key>
+    void SoftHeap<Key>::Insert(Key x) {
+        auto *carry = new SoftHeapNode<Key>(std::move(x));
+        size_t rank = 0;
+        while (occupied_ >> rank & 1u) {
+            occupied_ &= ~(uint64_t(1) << rank);
+            carry = SoftHeapNode<Key>::Link(roots_[rank], carry, corruption_rank_);
+            ++rank;
+        }
+        roots_[rank] = carry;
+        occupied_ |= uint64_t(1) << rank;
+        // Ranks below are free now, so only the new root needs an update.
+        UpdateSuffixMinimums(rank);
+        ++size_;
+    }
+
+    template<class Key>
+    Key SoftHeap<Key>::GetMinimum() {
+        return MinimalRoot()->items_.front();
+    }
+
+    template<class Key>
+    Key SoftHeap<Key>::GetMinimumCurrentKey() {
+        return MinimalRoot()->key_;
+    }
+
+    template<class Key>
+    bool SoftHeap<Key>::IsMinimumCorrupted() {
+        SoftHeapNode<Key> *v = MinimalRoot();
+        return v->items_.front() < v->key_;
+    }
+
+    template<class Key>
+    void SoftHeap<Key>::ExtractMinimum() {
+        SoftHeapNode<Key> *v = MinimalRoot();
+        size_t rank = v->rank_;
+        v->items_.pop_front();
+        if (v->items_.empty()) {
+            if (v->IsLeaf()) {
+                delete v;
+                occupied_ &= ~(uint64_t(1) << rank);
+            } else {
+                SoftHeapNode<Key>::Defill(v, corruption_rank_);
+            }
+        }
+        UpdateSuffixMinimums(rank);
+        --size_;
+    }
+
+    template<class Key>
+    void SoftHeap<Key>::Merge(HeapInterface<Key> &x) {
+        if (&x == this) {
+            throw SelfHeapMergeException();
+        }
+        try {
+            auto &casted = dynamic_cast<SoftHeap<Key> &>(x);
+            // Binary addition of the tables, as in RootTableBinomialHeap.
+            SoftHeapNode<Key> *carry = nullptr;
+            const uint64_t bits = occupied_ | casted.occupied_;
+            for (size_t rank = 0; rank < kMaxRank; ++rank) {
+                if (carry == nullptr && (bits >> rank) == 0) {
+                    break;
+                }
+                SoftHeapNode<Key> *summands[3];
+                size_t count = 0;
+                if (occupied_ >> rank & 1u) {
+                    summands[count++] = roots_[rank];
+                }
+                if (casted.occupied_ >> rank & 1u) {
+                    summands[count++] = casted.roots_[rank];
+                }
+                if (carry != nullptr) {
+                    summands[count++] = carry;
+                }
+                carry = count >= 2 ?
+                        SoftHeapNode<Key>::Link(summands[count - 1], summands[count - 2], corruption_rank_) : nullptr;
+                if (count % 2 == 1) {
+                    roots_[rank] = summands[0];
+                    occupied_ |= uint64_t(1) << rank;
+                } else {
+                    occupied_ &= ~(uint64_t(1) << rank);
+                }
+            }
+            UpdateSuffixMinimums(kMaxRank - 1);
+            size_ += casted.size_;
+            x.Detach();
+        } catch (const std::bad_cast &e) {
+            throw WrongHeapTypeException();
+        }
+    }
+
+    template<class Key>
+    size_t SoftHeap<Key>::Size() {
+        return size_;
+    }
+
+    template<class Key>
+    bool SoftHeap<Key>::Empty() {
+        return size_ == 0;
+    }
+
+    template<class Key>
+    void SoftHeap<Key>::Detach() {
+        occupied_ = 0;
+        size_ = 0;
+    }
+
+    template<class Key>
+    std::vector<Key> SoftHeap<Key>::Data() {
+        std::vector<Key> data;
+        for (uint64_t bits = occupied_; bits != 0; bits &= bits - 1) {
+            roots_[__builtin_ctzll(bits)]->CollectData(data);
+        }
+        std::sort(data.begin(), data.end());
+        return data;
+    }
+
+    template<class Key>
+    std::vector<Key> SoftHeap<Key>::CorruptedItems() {
+        std::vector<Key> data;
+        for (uint64_t bits = occupied_; bits != 0; bits &= bits - 1) {
+            roots_[__builtin_ctzll(bits)]->CollectCorrupted(data);
+        }
+        return data;
+    }
+
+    // Destructor
+    template<class Key>
+    SoftHeap<Key>::~SoftHeap() {
+        for (uint64_t bits = occupied_; bits != 0; bits &= bits - 1) {
+            delete roots_[__builtin_ctzll(bits)];
+        }
+    }
+
+    // Copy constructor
+    template<class Key>
+    SoftHeap<Key>::SoftHeap(const SoftHeap<Key> &other) : occupied_(other.occupied_),
+                                                          suffix_minimum_(other.suffix_minimum_),
+                                                          corruption_rank_(other.corruption_rank_),
+                                                          size_(other.size_) {
+        for (uint64_t bits = occupied_; bits != 0; bits &= bits - 1) {
+            auto rank = static_cast<size_t>(__builtin_ctzll(bits));
+            roots_[rank] = new SoftHeapNode<Key>(*other.roots_[rank]);
+        }
+    }
+
+    // Move constructor
+    template<class Key>
+    SoftHeap<Key>::SoftHeap(SoftHeap<Key> &&other) noexcept : SoftHeap(kDefaultEpsilon) {
+        Swap(other);
+    }
+
+    // Copy assignment operator
+    template<class Key>
+    SoftHeap<Key> &SoftHeap<Key>::operator=(const SoftHeap<Key> &other) {
+        if (this != &other) {
+            SoftHeap tmp(other);
+            Swap(tmp);
+        }
+        return *this;
+    }
+
+    // Move assignment operator
+    template<class Key>
+    SoftHeap<Key> &SoftHeap<Key>::operator=(SoftHeap<Key> &&other) noexcept {
+        if (this != &other) {
+            SoftHeap tmp(std::move(other));
+            Swap(tmp);
+        }
+        return *this;
+    }
+
+    template<class Key>
+    void SoftHeap<Key>::Swap(SoftHeap<Key> &x) noexcept {
+        std::swap(roots_, x.roots_);
+        std::swap(occupied_, x.occupied_);
+        std::swap(suffix_minimum_, x.suffix_minimum_);
+        std::swap(corruption_rank_, x.corruption_rank_);
+        std::swap(size_, x.size_);
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_SOFT_H
@@ -0,0 +1,56 @@
+#ifndef MERGEABLE_HEAPS_SOFT_SELECT_H
+#define MERGEABLE_HEAPS_SOFT_SELECT_H
+
+#include <vector>
+#include <stdexcept>
+#include <algorithm>
+#include "soft_heap.h"
+
+namespace heaps {
+    // Returns the k-th smallest key (0-based) in O(n) worst-case time.
+    // The pivot is found with a soft heap: after n / 3 extractions from the heap with epsilon = 1 / 3
+    // the greatest extracted key has rank between n / 3 and 2n / 3, so every step drops a third of the keys.
+    // Throws std::out_of_range, if k is not less than the number of keys.
+    template<class Key>
+    Key SoftSelect(std::vector<Key> keys, size_t k) {
+        if (k >= keys.size()) {
+            throw std::out_of_range("SoftSelect: k is out of range");
+        }
+        // Below this size the constant factor of the soft heap doesn't pay off.
+        static constexpr size_t kSmallSize = 64;
+        while (keys.size() > kSmallSize) {
+            SoftHeap<Key> heap(1.0 / 3);
+            for (const auto &key: keys) {
+                heap.Insert(key);
+            }
+            Key pivot = heap.GetMinimum();
+            for (size_t i = 0; i < keys.size() / 3; ++i) {
+                if (pivot < heap.GetMinimum()) {
+                    pivot = heap.GetMinimum();
+                }
+                heap.ExtractMinimum();
+            }
+
+            auto less_end = std::partition(keys.begin(), keys.end(), [&](const Key &key) {
+                return key < pivot;
+            });
+            auto equal_end = std::partition(less_end, keys.end(), [&](const Key &key) {
+                return !(pivot < key);
+            });
+            auto less = static_cast<size_t>(less_end - keys.begin());
+            auto not_greater = static_cast<size_t>(equal_end - keys.begin());
+            if (k < less) {
+                keys.erase(less_end, keys.end());
+            } else if (k < not_greater) {
+                return pivot;
+            } else {
+                keys.erase(keys.begin(), equal_end);
+                k -= not_greater;
+            }
+        }
+        std::nth_element(keys.begin(), keys.begin() + static_cast<std::ptrdiff_t>(k), keys.end());
+        return keys[k];
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_SOFT_SELECT_H
@@ -0,0 +1,310 @@
+#ifndef MERGEABLE_HEAPS_TIMER_QUEUE_H
+#define MERGEABLE_HEAPS_TIMER_QUEUE_H
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "lazy_binomial_heap.h"
+#include "exceptions.h"
+
+namespace heaps {
+    // Queue of timers, which carry a payload and fire at their deadlines.
+    // Heap orders the deadlines, with the default LazyBinomialHeap Schedule and Merge are O(1).
+    // Cancel only marks the timer in O(1), its entry stays in the heap and is dropped, when it reaches the top.
+    // When the cancelled entries outnumber the live ones, the heap is rebuilt without them,
+    // which adds amortized O(log n) to a cancellation.
+    // Timers live in chunks of records, which are moved as a whole on Merge, so the handles stay valid.
+    // Payload must be default constructible.
+    template<class Time, class Payload, template<class> class Heap = LazyBinomialHeap>
+    class TimerQueue {
+    private:
+        struct Record {
+            Payload payload_{};
+            // Incremented, when the timer fires or is cancelled, outdated handles don't match it.
+            uint32_t generation_ = 0;
+            Record *next_free_ = nullptr;
+        };
+
+        // Key of the heap. The entry is live, while its generation matches the record.
+        struct Entry {
+            Time deadline_;
+            uint32_t generation_;
+            Record *record_;
+
+            bool operator<(const Entry &other) const {
+                return deadline_ < other.deadline_;
+            }
+        };
+
+        static constexpr size_t kChunkSize = 256;
+        // The heap is not rebuilt, while the number of cancelled entries is below this.
+        static constexpr size_t kMinPurge = 64;
+
+        Heap<Entry> heap_;
+        std::vector<std::unique_ptr<Record[]>> chunks_;
+        // Free records, linked by next_free_
+        Record *free_head_;
+        Record *free_tail_;
+        // Number of scheduled timers, which are neither fired nor cancelled
+        size_t live_;
+        // Number of cancelled timers, which entries are still in the heap
+        size_t cancelled_;
+        // Due entries of the current ExpireUntil call
+        std::vector<Entry> due_;
+
+        Record *Allocate();
+
+        void Release(Record *record);
+
+        // Drops the cancelled entries from the top of the heap.
+        void SkipCancelled();
+
+        // Rebuilds the heap without the cancelled entries, if there are too many of them.
+        void MaybePurge();
+
+    public:
+        // Identifies a scheduled timer. Default constructed handle matches no timer.
+        struct Handle {
+            Record *record_ = nullptr;
+            uint32_t generation_ = 0;
+        };
+
+        TimerQueue();
+
+        // Schedules the timer. O(1) with LazyBinomialHeap
+        Handle Schedule(Time deadline, Payload payload);
+
+        // Cancels the timer. Returns false, if it has fired or was cancelled already.
+        // After a Merge the handle must be cancelled in the queue, which the timer was merged to.
+        bool Cancel(const Handle &handle);
+
+        // Fires all the timers with deadline <= now in the order of deadlines: callback(payload) is called for each.
+        // Due timers are taken out before the first callback, so the callbacks may schedule and cancel timers,
+        // the ones scheduled at or before "now" fire in the next call. Returns the number of fired timers.
+        template<class Callback>
+        size_t ExpireUntil(Time now, Callback &&callback);
+
+        // Deadline of the next timer to fire.
+        // Throws EmptyHeapException, if there is none
+        Time NextDeadline();
+
+        // Moves all the timers of x into *this, handles of x are handles of *this now. O(1) with LazyBinomialHeap
+        // Throws SelfHeapMergeException, if x is *this
+        void Merge(TimerQueue &x);
+
+        // Number of scheduled timers, which are neither fired nor cancelled
+        size_t Size() const;
+
+        bool Empty() const;
+
+        //
+        // Rule of Five functions
+        //
+
+        // Destructor
+        ~TimerQueue() = default;
+
+        // Records are referenced by the handles, so the queue isn't copyable.
+        TimerQueue(const TimerQueue &other) = delete;
+
+        TimerQueue &operator=(const TimerQueue &other) = delete;
+
+        // Move constructor. Other queue is left as newly initialized.
+        TimerQueue(TimerQueue &&other) noexcept;
+
+        // Move assignment operator
+        TimerQueue &operator=(TimerQueue &&other) noexcept;
+
+        void Swap(TimerQueue &x) noexcept;
+    };
+
+    template<class Time, class Payload, template<class> class Heap>
+    TimerQueue<Time, Payload, Heap>::TimerQueue() : free_head_(nullptr), free_tail_(nullptr), live_(0), cancelled_(0) {}
+
+    template<class Time, class Payload, template<class> class Heap>
+    typename TimerQueue<Time, Payload, Heap>::Record *TimerQueue<Time, Payload, Heap>::Allocate() {
+        if (free_head_ == nullptr) {
+            chunks_.push_back(std::make_unique<Record[]>(kChunkSize));
+            Record *chunk = chunks_.back().get();
+            for (size_t i = 0; i + 1 < kChunkSize; ++i) {
+                chunk[i].next_free_ = &chunk[i + 1];
+            }
+            free_head_ = chunk;
+            free_tail_ = &chunk[kChunkSize - 1];
+        }
+        Record *record = free_head_;
+        free_head_ = record->next_free_;
+        if (free_head_ == nullptr) {
+            free_tail_ = nullptr;
+        }
+        record->next_free_ = nullptr;
+        return record;
+    }
+
+    template<class Time, class Payload, template<class> class Heap>
+    void TimerQueue<Time, Payload, Heap>::Release(Record *record) {
+        record->payload_ = Payload();
+        record->next_free_ = free_head_;
+        free_head_ = record;
+        if (free_tail_ == nullptr) {
+            free_tail_ = record;
+        }
+    }
+
+    template<class Time, class Payload, template<class> class Heap>
+    void TimerQueue<Time, Payload, Heap>::SkipCancelled() {
+        while (!heap_.Empty()) {
+            Entry top = heap_.GetMinimum();
+            if (top.generation_ == top.record_->generation_) {
+                return;
+            }
+            heap_.ExtractMinimum();
+            Release(top.record_);
+            --cancelled_;
+        }
+    }
+
+    template<class Time, class Payload, template<class> class Heap>
+    void TimerQueue<Time, Payload, Heap>::MaybePurge() {
+        if (cancelled_ < kMinPurge || cancelled_ <= live_) {
+            return;
+        }
+        Heap<Entry> rebuilt;
+        while (!heap_.Empty()) {
+            Entry entry = heap_.GetMinimum();
+            heap_.ExtractMinimum();
+            if (entry.generation_ == entry.record_->generation_) {
+                rebuilt.Insert(entry);
+            } else {
+                Release(entry.record_);
+            }
+        }
+        std::swap(heap_, rebuilt);
+        cancelled_ = 0;
+    }
+
+    template<class Time, class Payload, template<class> class Heap>
+    typename TimerQueue<Time, Payload, Heap>::Handle TimerQueue<Time, Payload, Heap>::Schedule(Time deadline, Payload payload) {
+        Record *record = Allocate();
+        record->payload_ = std::move(payload);
+        heap_.Insert(Entry{deadline, record->generation_, record});
+        ++live_;
+        return Handle{record, record->generation_};
+    }
+
+    template<class Time, class Payload, template<class> class Heap>
+    bool TimerQueue<Time, Payload, Heap>::Cancel(const Handle &handle) {
+        if (handle.record_ == nullptr || handle.record_->generation_ != handle.generation_) {
+            return false;
+        }
+        ++handle.record_->generation_;
+        --live_;
+        ++cancelled_;
+        MaybePurge();
+        return true;
+    }
+
+    template<class Time, class Payload, template<class> class Heap>
+    template<class Callback>
+    size_t TimerQueue<Time, Payload, Heap>::ExpireUntil(Time now, Callback &&callback) {
+        due_.clear();
+        while (true) {
+            SkipCancelled();
+            if (heap_.Empty() || now < heap_.GetMinimum().deadline_) {
+                break;
+            }
+            Entry entry = heap_.GetMinimum();
+            heap_.ExtractMinimum();
+            // The handles are outdated before the callbacks, so cancelling a fired timer returns false.
+            ++entry.record_->generation_;
+            due_.push_back(entry);
+            --live_;
+        }
+        // Callbacks may reenter the queue, so the batch is moved out.
+        std::vector<Entry> batch;
+        batch.swap(due_);
+        for (const Entry &entry: batch) {
+            Payload payload = std::move(entry.record_->payload_);
+            Release(entry.record_);
+            callback(payload);
+        }
+        const size_t fired = batch.size();
+        batch.clear();
+        if (due_.capacity() < batch.capacity()) {
+            due_.swap(batch);
+        }
+        return fired;
+    }
+
+    template<class Time, class Payload, template<class> class Heap>
+    Time TimerQueue<Time, Payload, Heap>::NextDeadline() {
+        SkipCancelled();
+        if (heap_.Empty()) {
+            throw EmptyHeapException();
+        }
+        return heap_.GetMinimum().deadline_;
+    }
+
+    template<class Time, class Payload, template<class> class Heap>
+    void TimerQueue<Time, Payload, Heap>::Merge(TimerQueue &x) {
+        if (&x == this) {
+            throw SelfHeapMergeException();
+        }
+        heap_.Merge(x.heap_);
+        for (auto &chunk: x.chunks_) {
+            chunks_.push_back(std::move(chunk));
+        }
+        x.chunks_.clear();
+        if (x.free_head_ != nullptr) {
+            if (free_head_ == nullptr) {
+                free_head_ = x.free_head_;
+            } else {
+                free_tail_->next_free_ = x.free_head_;
+            }
+            free_tail_ = x.free_tail_;
+        }
+        x.free_head_ = x.free_tail_ = nullptr;
+        live_ += x.live_;
+        cancelled_ += x.cancelled_;
+        x.live_ = x.cancelled_ = 0;
+        MaybePurge();
+    }
+
+    template<class Time, class Payload, template<class> class Heap>
+    size_t TimerQueue<Time, Payload, Heap>::Size() const {
+        return live_;
+    }
+
+    template<class Time, class Payload, template<class> class Heap>
+    bool TimerQueue<Time, Payload, Heap>::Empty() const {
+        return live_ == 0;
+    }
+
+    // Move constructor
+    template<class Time, class Payload, template<class> class Heap>
+    TimerQueue<Time, Payload, Heap>::TimerQueue(TimerQueue &&other) noexcept : TimerQueue() {
+        Swap(other);
+    }
+
+    // Move assignment operator
+    template<class Time, class Payload, template<class> class Heap>
+    TimerQueue<Time, Payload, Heap> &TimerQueue<Time, Payload, Heap>::operator=(TimerQueue &&other) noexcept {
+        TimerQueue tmp(std::move(other));
+        Swap(tmp);
+        return *this;
+    }
+
+    template<class Time, class Payload, template<class> class Heap>
+    void TimerQueue<Time, Payload, Heap>::Swap(TimerQueue &x) noexcept {
+        std::swap(heap_, x.heap_);
+        chunks_.swap(x.chunks_);
+        std::swap(free_head_, x.free_head_);
+        std::swap(free_tail_, x.free_tail_);
+        std::swap(live_, x.live_);
+        std::swap(cancelled_, x.cancelled_);
+        due_.swap(x.due_);
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_TIMER_QUEUE_H
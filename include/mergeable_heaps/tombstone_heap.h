@@ -0,0 +1,463 @@
+#ifndef MERGEABLE_HEAPS_TOMBSTONE_H
+#define MERGEABLE_HEAPS_TOMBSTONE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "heap_interface.h"
+#include "exceptions.h"
+#include "leftist_heap.h"
+
+namespace heaps {
+    // Heap with lazy deletion of arbitrary items. Heap is LeftistHeap, SkewHeap or BinomialHeap.
+    // Every item has a record, MarkDeleted and EraseIf only turn the records into tombstones,
+    // the entries of the dead items stay in the heap and are freed, when they surface at the root.
+    // When the dead items exceed the given fraction of the heap, it is rebuilt from the live ones in O(n).
+    // The records live in chunks, which are moved as a whole on Merge, so the handles stay valid.
+    template<class Key, template<class> class Heap = LeftistHeap>
+    class TombstoneHeap : public HeapInterface<Key> {
+    private:
+        struct Record {
+            Key key_{};
+            // Incremented, when the record is freed, outdated handles don't match it.
+            uint32_t generation_ = 0;
+            bool in_use_ = false;
+            bool dead_ = false;
+            Record *next_free_ = nullptr;
+        };
+
+        // Key of the inner heap. The key is copied from the record, so the comparisons don't follow the pointer.
+        struct Entry {
+            Key key_;
+            Record *record_;
+
+            bool operator<(const Entry &other) const {
+                return key_ < other.key_;
+            }
+        };
+
+        static constexpr size_t kChunkSize = 256;
+        // The heap is not compacted, while the number of dead items is below this.
+        static constexpr size_t kMinCompaction = 64;
+
+        Heap<Entry> heap_;
+        std::vector<std::unique_ptr<Record[]>> chunks_;
+        // Free records, linked by next_free_
+        Record *free_head_;
+        Record *free_tail_;
+        size_t live_;
+        size_t dead_;
+        double max_dead_fraction_;
+
+        Record *Allocate();
+
+        void Release(Record *record);
+
+        // Frees the dead entries at the root of the heap.
+        void SkipDead();
+
+        // Compacts the heap, if the dead items exceed the fraction.
+        void MaybeCompact();
+
+        // Inserts the keys of the other heap one by one.
+        void CopyFrom(const TombstoneHeap &other);
+
+    public:
+        // Identifies an item of the heap. Default constructed handle matches no item.
+        struct Handle {
+            Record *record_ = nullptr;
+            uint32_t generation_ = 0;
+        };
+
+        // Fraction of the dead items, after which the heap is compacted
+        static constexpr double kDefaultMaxDeadFraction = 0.5;
+
+        // Constructor for empty heap
+        TombstoneHeap();
+
+        // Constructor for one-item heap
+        explicit TombstoneHeap(Key key);
+
+        // Returns an empty heap, which is compacted after the dead items exceed max_dead_fraction of it.
+        // Not a constructor, so it doesn't clash with the one-item constructor for the floating point keys.
+        static TombstoneHeap WithDeadFraction(double max_dead_fraction);
+
+        // Inserts an item into the heap
+        void Insert(Key x) override;
+
+        // Inserts an item into the heap and returns its handle
+        Handle InsertWithHandle(Key x);
+
+        // Return the minimal live item in heap. Dead items at the root are freed.
+        // Throws EmptyHeapException, if there is none
+        Key GetMinimum() override;
+
+        // Extracts minimal live item from the heap
+        // Throws EmptyHeapException, if there is none
+        void ExtractMinimum() override;
+
+        // Marks the item deleted. Returns false, if it is extracted or deleted already.
+        bool MarkDeleted(const Handle &handle);
+
+        // Marks deleted all the live items, for which predicate(key) is true. O(n)
+        // Returns the number of deleted items.
+        template<class Predicate>
+        size_t EraseIf(Predicate &&predicate);
+
+        // Rebuilds the heap from the live items in O(n), all the dead ones are freed.
+        void Compact();
+
+        // Merges an abstract heap into *this, handles of x are handles of *this now.
+        // Throws WrongHeapTypeException, if x is not a TombstoneHeap of the same type
+        void Merge(HeapInterface<Key> &x) override;
+
+        // Return number of live items in the heap
+        size_t Size() override;
+
+        // Checks if there are no live items in the heap
+        bool Empty() override;
+
+        // Number of live items
+        size_t LiveCount() const;
+
+        // Number of dead items, which are not freed yet
+        size_t DeadCount() const;
+
+        // Detaches heap from its nodes and records without deleting them
+        // Now, it's user's responsibility to free their memory.
+        void Detach() override;
+
+        // Returns sorted std::vector with all the live keys from the heap.
+        // Mainly for debug purposes.
+        std::vector<Key> Data();
+
+        //
+        // Rule of Five functions
+        //
+
+        // Destructor
+        ~TombstoneHeap() override = default;
+
+        // Copy constructor. Copies the live items, handles of other don't refer to the copy.
+        TombstoneHeap(const TombstoneHeap &other);
+
+        // Move constructor. Other heap is left as newly initialized.
+        TombstoneHeap(TombstoneHeap &&other) noexcept;
+
+        // Copy assignment operator
+        TombstoneHeap &operator=(const TombstoneHeap &other);
+
+        // Move assignment operator
+        TombstoneHeap &operator=(TombstoneHeap &&other) noexcept;
+
+        // Swap function for "Copy and Swap" idiom
+        void Swap(TombstoneHeap &x) noexcept;
+    };
+
+    template<class Key, template<class> class Heap>
+    TombstoneHeap<Key, Heap>::TombstoneHeap() : free_head_(nullptr), free_tail_(nullptr), live_(0), dead_(0),
+                                                max_dead_fraction_(kDefaultMaxDeadFraction) {}
+
+    template<class Key, template<class> class Heap>
+    TombstoneHeap<Key, Heap>::TombstoneHeap(Key key) : TombstoneHeap() {
+        Insert(key);
+    }
+
+    template<class Key, template<class> class Heap>
+    TombstoneHeap<Key, Heap> TombstoneHeap<Key, Heap>::WithDeadFraction(double max_dead_fraction) {
+        TombstoneHeap heap;
+        heap.max_dead_fraction_ = max_dead_fraction;
+        return heap;
+    }
+
+    template<class Key, template<class> class Heap>
+    typename TombstoneHeap<Key, Heap>::Record *TombstoneHeap<Key, Heap>::Allocate() {
+        if (free_head_ == nullptr) {
+            chunks_.push_back(std::make_unique<Record[]>(kChunkSize));
+            Record *chunk = chunks_.back().get();
+            for (size_t i = 0; i + 1 < kChunkSize; ++i) {
+                chunk[i].next_free_ = &chunk[i + 1];
+            }
+            free_head_ = chunk;
+            free_tail_ = &chunk[kChunkSize - 1];
+        }
+        Record *record = free_head_;
+        free_head_ = record->next_free_;
+        if (free_head_ == nullptr) {
+            free_tail_ = nullptr;
+        }
+        record->next_free_ = nullptr;
+        record->in_use_ = true;
+        record->dead_ = false;
+        return record;
+    }
+
+    template<class Key, template<class> class Heap>
+    void TombstoneHeap<Key, Heap>::Release(Record *record) {
+        ++record->generation_;
+        record->in_use_ = false;
+        record->key_ = Key();
+        record->next_free_ = free_head_;
+        free_head_ = record;
+        if (free_tail_ == nullptr) {
+            free_tail_ = record;
+        }
+    }
+
+    template<class Key, template<class> class Heap>
+    void TombstoneHeap<Key, Heap>::SkipDead() {
+        while (dead_ > 0 && !heap_.Empty()) {
+            Record *record = heap_.GetMinimum().record_;
+            if (!record->dead_) {
+                return;
+            }
+            heap_.ExtractMinimum();
+            Release(record);
+            --dead_;
+        }
+    }
+
+    template<class Key, template<class> class Heap>
+    void TombstoneHeap<Key, Heap>::MaybeCompact() {
+        if (dead_ >= kMinCompaction && static_cast<double>(dead_) > max_dead_fraction_ * static_cast<double>(live_ + dead_)) {
+            Compact();
+        }
+    }
+
+    template<class Key, template<class> class Heap>
+    void TombstoneHeap<Key, Heap>::Compact() {
+        // Live records are found in the chunks, the old heap is dropped.
+        heap_ = Heap<Entry>();
+        std::vector<Heap<Entry>> level;
+        level.reserve(live_);
+        for (auto &chunk: chunks_) {
+            for (size_t i = 0; i < kChunkSize; ++i) {
+                Record *record = &chunk[i];
+                if (!record->in_use_) {
+                    continue;
+                }
+                if (record->dead_) {
+                    Release(record);
+                } else {
+                    level.emplace_back(Entry{record->key_, record});
+                }
+            }
+        }
+        dead_ = 0;
+        // Heaps are melded pairwise, level by level: O(n) for the leftist, skew and binomial heaps.
+        while (level.size() > 1) {
+            for (size_t i = 0; 2 * i + 1 < level.size(); ++i) {
+                level[2 * i].Merge(level[2 * i + 1]);
+                if (i > 0) {
+                    std::swap(level[i], level[2 * i]);
+                }
+            }
+            if (level.size() % 2 == 1) {
+                std::swap(level[level.size() / 2], level.back());
+            }
+            level.resize((level.size() + 1) / 2);
+        }
+        if (!level.empty()) {
+            std::swap(heap_, level[0]);
+        }
+    }
+
+    template<class Key, template<class> class Heap>
+    void TombstoneHeap<Key, Heap>::Insert(Key x) {
+        InsertWithHandle(x);
+    }
+
+    template<class Key, template<class> class Heap>
+    typename TombstoneHeap<Key, Heap>::Handle TombstoneHeap<Key, Heap>::InsertWithHandle(Key x) {
+        Record *record = Allocate();
+        record->key_ = x;
+        heap_.Insert(Entry{x, record});
+        ++live_;
+        return Handle{record, record->generation_};
+    }
+
+    template<class Key, template<class> class Heap>
+    Key TombstoneHeap<Key, Heap>::GetMinimum() {
+        if (Empty()) {
+            throw EmptyHeapException();
+        }
+        SkipDead();
+        return heap_.GetMinimum().key_;
+    }
+
+    template<class Key, template<class> class Heap>
+    void TombstoneHeap<Key, Heap>::ExtractMinimum() {
+        if (Empty()) {
+            throw EmptyHeapException();
+        }
+        SkipDead();
+        Record *record = heap_.GetMinimum().record_;
+        heap_.ExtractMinimum();
+        Release(record);
+        --live_;
+        SkipDead();
+    }
+
+    template<class Key, template<class> class Heap>
+    bool TombstoneHeap<Key, Heap>::MarkDeleted(const Handle &handle) {
+        Record *record = handle.record_;
+        if (record == nullptr || record->generation_ != handle.generation_ || record->dead_) {
+            return false;
+        }
+        record->dead_ = true;
+        --live_;
+        ++dead_;
+        MaybeCompact();
+        return true;
+    }
+
+    template<class Key, template<class> class Heap>
+    template<class Predicate>
+    size_t TombstoneHeap<Key, Heap>::EraseIf(Predicate &&predicate) {
+        size_t erased = 0;
+        for (auto &chunk: chunks_) {
+            for (size_t i = 0; i < kChunkSize; ++i) {
+                Record &record = chunk[i];
+                if (record.in_use_ && !record.dead_ && predicate(record.key_)) {
+                    record.dead_ = true;
+                    ++erased;
+                }
+            }
+        }
+        live_ -= erased;
+        dead_ += erased;
+        MaybeCompact();
+        return erased;
+    }
+
+    template<class Key, template<class> class Heap>
+    void TombstoneHeap<Key, Heap>::Merge(HeapInterface<Key> &x) {
+        if (&x == this) {
+            throw SelfHeapMergeException();
+        }
+        try {
+            auto &casted = dynamic_cast<TombstoneHeap<Key, Heap> &>(x);
+            heap_.Merge(casted.heap_);
+            for (auto &chunk: casted.chunks_) {
+                chunks_.push_back(std::move(chunk));
+            }
+            casted.chunks_.clear();
+            if (casted.free_head_ != nullptr) {
+                if (free_head_ == nullptr) {
+                    free_head_ = casted.free_head_;
+                } else {
+                    free_tail_->next_free_ = casted.free_head_;
+                }
+                free_tail_ = casted.free_tail_;
+            }
+            live_ += casted.live_;
+            dead_ += casted.dead_;
+            x.Detach();
+        } catch (const std::bad_cast &e) {
+            throw WrongHeapTypeException();
+        }
+        MaybeCompact();
+    }
+
+    template<class Key, template<class> class Heap>
+    size_t TombstoneHeap<Key, Heap>::Size() {
+        return live_;
+    }
+
+    template<class Key, template<class> class Heap>
+    bool TombstoneHeap<Key, Heap>::Empty() {
+        return live_ == 0;
+    }
+
+    template<class Key, template<class> class Heap>
+    size_t TombstoneHeap<Key, Heap>::LiveCount() const {
+        return live_;
+    }
+
+    template<class Key, template<class> class Heap>
+    size_t TombstoneHeap<Key, Heap>::DeadCount() const {
+        return dead_;
+    }
+
+    template<class Key, template<class> class Heap>
+    void TombstoneHeap<Key, Heap>::Detach() {
+        // BinomialHeap hides Detach, it's public in the interface.
+        static_cast<HeapInterface<Entry> &>(heap_).Detach();
+        for (auto &chunk: chunks_) {
+            chunk.release();
+        }
+        chunks_.clear();
+        free_head_ = free_tail_ = nullptr;
+        live_ = dead_ = 0;
+    }
+
+    template<class Key, template<class> class Heap>
+    std::vector<Key> TombstoneHeap<Key, Heap>::Data() {
+        std::vector<Key> data;
+        data.reserve(live_);
+        for (auto &chunk: chunks_) {
+            for (size_t i = 0; i < kChunkSize; ++i) {
+                if (chunk[i].in_use_ && !chunk[i].dead_) {
+                    data.push_back(chunk[i].key_);
+                }
+            }
+        }
+        std::sort(data.begin(), data.end());
+        return data;
+    }
+
+    template<class Key, template<class> class Heap>
+    void TombstoneHeap<Key, Heap>::CopyFrom(const TombstoneHeap &other) {
+        for (const auto &chunk: other.chunks_) {
+            for (size_t i = 0; i < kChunkSize; ++i) {
+                if (chunk[i].in_use_ && !chunk[i].dead_) {
+                    Insert(chunk[i].key_);
+                }
+            }
+        }
+    }
+
+    // Copy constructor
+    template<class Key, template<class> class Heap>
+    TombstoneHeap<Key, Heap>::TombstoneHeap(const TombstoneHeap &other) : TombstoneHeap() {
+        max_dead_fraction_ = other.max_dead_fraction_;
+        CopyFrom(other);
+    }
+
+    // Move constructor
+    template<class Key, template<class> class Heap>
+    TombstoneHeap<Key, Heap>::TombstoneHeap(TombstoneHeap &&other) noexcept : TombstoneHeap() {
+        Swap(other);
+    }
+
+    // Copy assignment operator
+    template<class Key, template<class> class Heap>
+    TombstoneHeap<Key, Heap> &TombstoneHeap<Key, Heap>::operator=(const TombstoneHeap &other) {
+        TombstoneHeap tmp(other);
+        Swap(tmp);
+        return *this;
+    }
+
+    // Move assignment operator
+    template<class Key, template<class> class Heap>
+    TombstoneHeap<Key, Heap> &TombstoneHeap<Key, Heap>::operator=(TombstoneHeap &&other) noexcept {
+        TombstoneHeap tmp(std::move(other));
+        Swap(tmp);
+        return *this;
+    }
+
+    template<class Key, template<class> class Heap>
+    void TombstoneHeap<Key, Heap>::Swap(TombstoneHeap &x) noexcept {
+        std::swap(heap_, x.heap_);
+        chunks_.swap(x.chunks_);
+        std::swap(free_head_, x.free_head_);
+        std::swap(free_tail_, x.free_tail_);
+        std::swap(live_, x.live_);
+        std::swap(dead_, x.dead_);
+        std::swap(max_dead_fraction_, x.max_dead_fraction_);
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_TOMBSTONE_H
@@ -0,0 +1,71 @@
+#ifndef MERGEABLE_HEAPS_WEIGHT_BIASED_LEFTIST_H
+#define MERGEABLE_HEAPS_WEIGHT_BIASED_LEFTIST_H
+
+#include <iterator>
+#include <random>
+#include "classical_heap.h"
+#include "nodes/weight_biased_leftist_heap_node.h"
+
+namespace heaps {
+    // Weight-Biased Leftist Heap implementation. Key is the type of data stored
+    // Nodes store the sizes of their subtrees instead of the ranks, the merge is one iterative pass down
+    // the right spines. Size() is exact in O(1) even after SplitLeftSubtree.
+    // Up to InlineCapacity keys are stored inline, without allocating the nodes.
+    template<class Key = int, size_t InlineCapacity = 0>
+    class WeightBiasedLeftistHeap : public ClassicalHeap<Key, WeightBiasedLeftistHeapNode<Key>, InlineCapacity> {
+        using Base = ClassicalHeap<Key, WeightBiasedLeftistHeapNode<Key>, InlineCapacity>;
+        using Node = WeightBiasedLeftistHeapNode<Key>;
+    public:
+        // Constructor for empty heap
+        WeightBiasedLeftistHeap() = default;
+
+        // Constructor for one-item heap
+        explicit WeightBiasedLeftistHeap(Key key);
+
+        // Return number of items in the heap. O(1)
+        size_t Size() override;
+
+        // Return a key chosen uniformly at random. The subtree sizes lead to it from the root,
+        // O(depth of the chosen node).
+        // Throws EmptyHeapException, if there is none
+        template<class Generator>
+        Key Sample(Generator &gen);
+    };
+
+    template<class Key, size_t InlineCapacity>
+    WeightBiasedLeftistHeap<Key, InlineCapacity>::WeightBiasedLeftistHeap(Key key) : Base(key) {}
+
+    template<class Key, size_t InlineCapacity>
+    size_t WeightBiasedLeftistHeap<Key, InlineCapacity>::Size() {
+        return Node::Weight(this->root_) + this->inline_.Size();
+    }
+
+    template<class Key, size_t InlineCapacity>
+    template<class Generator>
+    Key WeightBiasedLeftistHeap<Key, InlineCapacity>::Sample(Generator &gen) {
+        if (this->Empty()) {
+            throw EmptyHeapException();
+        }
+        size_t index = std::uniform_int_distribution<size_t>(0, Size() - 1)(gen);
+        if (this->root_ == nullptr) {
+            return *std::next(this->inline_.begin(), static_cast<std::ptrdiff_t>(index));
+        }
+        // index is the position of the key in the in-order walk of the subtree of v.
+        Node *v = this->root_;
+        while (true) {
+            v->PushDown();
+            const size_t left = Node::Weight(v->child_left_);
+            if (index == left) {
+                return v->key_;
+            }
+            if (index < left) {
+                v = v->child_left_;
+            } else {
+                index -= left + 1;
+                v = v->child_right_;
+            }
+        }
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_WEIGHT_BIASED_LEFTIST_H
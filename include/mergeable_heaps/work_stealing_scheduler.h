@@ -0,0 +1,258 @@
+#ifndef MERGEABLE_HEAPS_WORK_STEALING_SCHEDULER_H
+#define MERGEABLE_HEAPS_WORK_STEALING_SCHEDULER_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "leftist_heap.h"
+
+namespace heaps {
+    // Thread pool, where every worker owns a priority queue of the tasks, tasks with smaller priority run first.
+    // Heap is LeftistHeap or SkewHeap: an idle worker steals the left subtree of the root of the busiest queue
+    // in O(1) under the victim's lock and melds it into its own queue, so about a half of the tasks moves at once.
+    // Tasks must not throw.
+    template<template<class> class Heap = LeftistHeap>
+    class WorkStealingScheduler {
+    public:
+        using Task = std::function<void()>;
+
+        // Starts the workers, at least one.
+        explicit WorkStealingScheduler(size_t workers_cnt = std::thread::hardware_concurrency());
+
+        // Waits for all the tasks and stops the workers.
+        ~WorkStealingScheduler();
+
+        WorkStealingScheduler(const WorkStealingScheduler &) = delete;
+
+        WorkStealingScheduler &operator=(const WorkStealingScheduler &) = delete;
+
+        // Adds the task. Tasks submitted by a worker go to its own queue, the others are spread round-robin.
+        // Tasks of the same priority in one queue run in the order of submission.
+        void Submit(int64_t priority, Task task);
+
+        // Blocks until all the submitted tasks, including the ones they submit, are finished.
+        // Must not be called from a task.
+        void Wait();
+
+        size_t WorkersCount() const;
+
+        // Number of the tasks waiting in the queue of the worker
+        size_t QueueDepth(size_t worker) const;
+
+        // Number of successful steals made by the worker
+        size_t StealCount(size_t worker) const;
+
+        // Number of the tasks the worker got by stealing
+        size_t StolenTasks(size_t worker) const;
+
+    private:
+        // Key of the queues, owns the task.
+        struct Entry {
+            int64_t priority_;
+            uint64_t sequence_;
+            Task *task_;
+
+            bool operator<(const Entry &other) const {
+                return priority_ < other.priority_ || (priority_ == other.priority_ && sequence_ < other.sequence_);
+            }
+        };
+
+        struct Worker {
+            std::mutex mutex_;
+            Heap<Entry> queue_;
+            std::atomic<size_t> depth_{0};
+            std::atomic<size_t> steals_{0};
+            std::atomic<size_t> stolen_tasks_{0};
+        };
+
+        std::vector<std::unique_ptr<Worker>> workers_;
+        std::vector<std::thread> threads_;
+        std::atomic<uint64_t> sequence_{0};
+        std::atomic<size_t> next_worker_{0};
+        // Tasks submitted and not finished yet
+        std::atomic<size_t> pending_{0};
+        // Tasks waiting in the queues
+        std::atomic<size_t> queued_{0};
+        std::atomic<size_t> sleeping_{0};
+        bool stopping_ = false;
+        std::mutex idle_mutex_;
+        std::condition_variable idle_;
+        std::mutex done_mutex_;
+        std::condition_variable done_;
+
+        // Scheduler and index of the worker, which runs the current thread
+        inline static thread_local const WorkStealingScheduler *current_scheduler_ = nullptr;
+        inline static thread_local size_t current_worker_ = 0;
+
+        void Run(size_t worker);
+
+        // Takes the task with the smallest priority from the own queue.
+        bool PopLocal(size_t worker, Entry &entry);
+
+        // Moves a part of the largest queue into the own one. Returns false, if nothing was stolen.
+        bool Steal(size_t worker);
+    };
+
+    template<template<class> class Heap>
+    WorkStealingScheduler<Heap>::WorkStealingScheduler(size_t workers_cnt) {
+        workers_cnt = std::max<size_t>(workers_cnt, 1);
+        for (size_t i = 0; i < workers_cnt; ++i) {
+            workers_.push_back(std::make_unique<Worker>());
+        }
+        for (size_t i = 0; i < workers_cnt; ++i) {
+            threads_.emplace_back([this, i] { Run(i); });
+        }
+    }
+
+    template<template<class> class Heap>
+    WorkStealingScheduler<Heap>::~WorkStealingScheduler() {
+        Wait();
+        {
+            std::lock_guard<std::mutex> lock(idle_mutex_);
+            stopping_ = true;
+        }
+        idle_.notify_all();
+        for (auto &thread: threads_) {
+            thread.join();
+        }
+    }
+
+    template<template<class> class Heap>
+    void WorkStealingScheduler<Heap>::Submit(int64_t priority, Task task) {
+        size_t index = current_scheduler_ == this ? current_worker_ : next_worker_++ % workers_.size();
+        Worker &worker = *workers_[index];
+        Entry entry{priority, sequence_++, new Task(std::move(task))};
+        ++pending_;
+        {
+            // The counters are raised under the lock, so the task isn't taken before it's counted.
+            std::lock_guard<std::mutex> lock(worker.mutex_);
+            worker.queue_.Insert(entry);
+            ++worker.depth_;
+            ++queued_;
+        }
+        // The sleeper counts itself before checking queued_, so one of the sides sees the other.
+        if (sleeping_ > 0) {
+            std::lock_guard<std::mutex> lock(idle_mutex_);
+            idle_.notify_one();
+        }
+    }
+
+    template<template<class> class Heap>
+    void WorkStealingScheduler<Heap>::Wait() {
+        std::unique_lock<std::mutex> lock(done_mutex_);
+        done_.wait(lock, [this] { return pending_ == 0; });
+    }
+
+    template<template<class> class Heap>
+    size_t WorkStealingScheduler<Heap>::WorkersCount() const {
+        return workers_.size();
+    }
+
+    template<template<class> class Heap>
+    size_t WorkStealingScheduler<Heap>::QueueDepth(size_t worker) const {
+        return workers_[worker]->depth_;
+    }
+
+    template<template<class> class Heap>
+    size_t WorkStealingScheduler<Heap>::StealCount(size_t worker) const {
+        return workers_[worker]->steals_;
+    }
+
+    template<template<class> class Heap>
+    size_t WorkStealingScheduler<Heap>::StolenTasks(size_t worker) const {
+        return workers_[worker]->stolen_tasks_;
+    }
+
+    template<template<class> class Heap>
+    void WorkStealingScheduler<Heap>::Run(size_t worker) {
+        current_scheduler_ = this;
+        current_worker_ = worker;
+        while (true) {
+            Entry entry{};
+            if (PopLocal(worker, entry) || (Steal(worker) && PopLocal(worker, entry))) {
+                (*entry.task_)();
+                delete entry.task_;
+                if (--pending_ == 0) {
+                    std::lock_guard<std::mutex> lock(done_mutex_);
+                    done_.notify_all();
+                }
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(idle_mutex_);
+            ++sleeping_;
+            idle_.wait(lock, [this] { return stopping_ || queued_ > 0; });
+            --sleeping_;
+            if (stopping_) {
+                return;
+            }
+        }
+    }
+
+    template<template<class> class Heap>
+    bool WorkStealingScheduler<Heap>::PopLocal(size_t worker, Entry &entry) {
+        Worker &self = *workers_[worker];
+        {
+            std::lock_guard<std::mutex> lock(self.mutex_);
+            if (self.queue_.Empty()) {
+                return false;
+            }
+            entry = self.queue_.GetMinimum();
+            self.queue_.ExtractMinimum();
+            --self.depth_;
+            --queued_;
+        }
+        return true;
+    }
+
+    template<template<class> class Heap>
+    bool WorkStealingScheduler<Heap>::Steal(size_t worker) {
+        size_t victim_index = worker;
+        size_t victim_depth = 0;
+        for (size_t i = 0; i < workers_.size(); ++i) {
+            size_t depth = workers_[i]->depth_;
+            if (i != worker && depth > victim_depth) {
+                victim_index = i;
+                victim_depth = depth;
+            }
+        }
+        if (victim_index == worker) {
+            return false;
+        }
+        Worker &victim = *workers_[victim_index];
+        Worker &self = *workers_[worker];
+        auto stolen = [&] {
+            std::lock_guard<std::mutex> lock(victim.mutex_);
+            auto subtree = victim.queue_.SplitLeftSubtree();
+            // The root has no children, the only task is taken.
+            if (subtree.Empty() && !victim.queue_.Empty()) {
+                subtree.Insert(victim.queue_.GetMinimum());
+                victim.queue_.ExtractMinimum();
+            }
+            return subtree;
+        }();
+        if (stolen.Empty()) {
+            return false;
+        }
+        // Counting the stolen tasks is O(size), it's done outside of the victim's lock.
+        // Until then the victim's depth is too large, but never less than its queue.
+        size_t stolen_cnt = stolen.Size();
+        victim.depth_ -= stolen_cnt;
+        {
+            // Raised with the merge, so the tasks aren't stolen from self before they are counted.
+            std::lock_guard<std::mutex> lock(self.mutex_);
+            self.queue_.Merge(stolen);
+            self.depth_ += stolen_cnt;
+        }
+        ++self.steals_;
+        self.stolen_tasks_ += stolen_cnt;
+        return true;
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_WORK_STEALING_SCHEDULER_H
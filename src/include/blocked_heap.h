@@ -0,0 +1,251 @@
+#ifndef MERGEABLE_HEAPS_BLOCKED_HEAP_H
+#define MERGEABLE_HEAPS_BLOCKED_HEAP_H
+
+#include <vector>
+#include <algorithm>
+#include "mergeable_heaps/exceptions.h"
+#include "heap_interface.h"
+
+namespace heaps {
+    // Heap, which nodes store small blocks of keys instead of one key.
+    // Blocked Leftist and Skew Heaps are based on the BlockedHeap.
+    // Keys are inserted into existing blocks when the order allows it,
+    // extraction from a block which doesn't become empty needs no pointer updates.
+    template<class Key, class NodeType>
+    class BlockedHeap : public HeapInterface<Key> {
+    protected:
+        // Maximal number of nodes visited by Insert looking for a block with a free slot.
+        static constexpr size_t kInsertProbeDepth = 64;
+
+        // Link to the root of the tree. If there is none, nullptr.
+        NodeType *root_;
+        // Number of items in the heap
+        size_t size_;
+
+    public:
+        // Constructor of the empty heap
+        BlockedHeap();
+
+        // Constructor of the one-item heap
+        explicit BlockedHeap(Key x);
+
+        // Inserts an item into the heap
+        void Insert(Key x) override;
+
+        // Return the minimal item in heap.
+        // Throws EmptyHeapException, if there is none
+        Key GetMinimum() override;
+
+        // Extracts minimal item from the heap.
+        // Throws EmptyHeapException, if there is none
+        void ExtractMinimum() override;
+
+        // Merges an abstract heap into *this.
+        // Throws WrongHeapTypeException, if x is not the same BlockedHeap
+        void Merge(HeapInterface<Key> &x) override;
+
+        // Return number of items in the heap
+        size_t Size() override;
+
+        // Checks if the heap is empty
+        bool Empty() override;
+
+        // Detaches heap from its nodes without deleting them
+        // Now, it's user's responsibility to free node's memory.
+        void Detach() override;
+
+        // Passes all the keys to callback in no particular order and deletes the nodes on the way.
+        // The heap becomes empty. O(n)
+        template<class Callback>
+        void TakeKeys(Callback &&callback);
+
+        // Returns sorted std::vector with all the keys from the heap.
+        // Mainly for debug purposes.
+        std::vector<Key> Data();
+
+        //
+        // Rule of Five functions
+        //
+
+        // Destructor. Destructs the heap with all it's nodes
+        // Unless they are detached.
+        ~BlockedHeap();
+
+        // Copy constructor. Creates the copy of the heap and all it's nodes
+        BlockedHeap(const BlockedHeap<Key, NodeType> &other);
+
+        // Move constructor. Creates the copy of the heap by stealing resources.
+        // Other heap is left as newly initialized.
+        BlockedHeap(BlockedHeap<Key, NodeType> &&other) noexcept;
+
+        // Copy assignment operator
+        BlockedHeap<Key, NodeType> &operator=(const BlockedHeap<Key, NodeType> &other);
+
+        // Move assignment operator
+        BlockedHeap<Key, NodeType> &operator=(BlockedHeap<Key, NodeType> &&other) noexcept;
+
+        // Swap function for "Copy and Swap" idiom
+        void Swap(BlockedHeap<Key, NodeType> &x) noexcept;
+    };
+
+    template<class Key, class NodeType>
+    BlockedHeap<Key, NodeType>::BlockedHeap() : root_(nullptr), size_(0) {}
+
+    template<class Key, class NodeType>
+    BlockedHeap<Key, NodeType>::BlockedHeap(Key x) : root_(new NodeType(x)), size_(1) {}
+
+    template<class Key, class NodeType>
+    void BlockedHeap<Key, NodeType>::Insert(Key x) {
+        // Going down the right path, all the keys above the current node are not greater than x.
+        NodeType *v = root_;
+        for (size_t depth = 0; v != nullptr && depth < kInsertProbeDepth; ++depth) {
+            if (!v->keys_.Full() && v->FitsAboveChildren(x)) {
+                v->keys_.Push(x);
+                ++size_;
+                return;
+            }
+            if (v->keys_.GreaterMask(x) != 0) {
+                break;
+            }
+            v = v->child_right_;
+        }
+        root_ = NodeType::Merge_(root_, new NodeType(x));
+        ++size_;
+    }
+
+    template<class Key, class NodeType>
+    Key BlockedHeap<Key, NodeType>::GetMinimum() {
+        if (Empty()) {
+            throw EmptyHeapException();
+        }
+        return root_->keys_.Min();
+    }
+
+    template<class Key, class NodeType>
+    void BlockedHeap<Key, NodeType>::ExtractMinimum() {
+        if (Empty()) {
+            throw EmptyHeapException();
+        }
+        root_->keys_.Erase(root_->keys_.MinIndex());
+        --size_;
+        if (root_->keys_.Empty()) {
+            NodeType *left = root_->child_left_;
+            NodeType *right = root_->child_right_;
+            root_->Detach();
+            delete root_;
+            root_ = NodeType::Merge_(left, right);
+        }
+    }
+
+    template<class Key, class NodeType>
+    void BlockedHeap<Key, NodeType>::Merge(HeapInterface<Key> &x) {
+        if (&x == this) {
+            throw SelfHeapMergeException();
+        }
+        try {
+            auto &casted = dynamic_cast<BlockedHeap<Key, NodeType> &>(x);
+            root_ = NodeType::Merge_(root_, casted.root_);
+            size_ += casted.size_;
+            x.Detach();
+        } catch (const std::bad_cast &e) {
+            throw WrongHeapTypeException();
+        }
+    }
+
+    template<class Key, class NodeType>
+    size_t BlockedHeap<Key, NodeType>::Size() {
+        return size_;
+    }
+
+    template<class Key, class NodeType>
+    bool BlockedHeap<Key, NodeType>::Empty() {
+        return root_ == nullptr;
+    }
+
+    template<class Key, class NodeType>
+    void BlockedHeap<Key, NodeType>::Detach() {
+        root_ = nullptr;
+        size_ = 0;
+    }
+
+    template<class Key, class NodeType>
+    template<class Callback>
+    void BlockedHeap<Key, NodeType>::TakeKeys(Callback &&callback) {
+        std::vector<NodeType *> stack;
+        if (root_ != nullptr) {
+            stack.push_back(root_);
+        }
+        while (!stack.empty()) {
+            NodeType *v = stack.back();
+            stack.pop_back();
+            for (NodeType *child: {v->child_left_, v->child_right_}) {
+                if (child != nullptr) {
+                    stack.push_back(child);
+                }
+            }
+            for (size_t i = 0; i < v->keys_.size_; ++i) {
+                callback(v->keys_.keys_[i]);
+            }
+            v->Detach();
+            delete v;
+        }
+        Detach();
+    }
+
+    template<class Key, class NodeType>
+    std::vector<Key> BlockedHeap<Key, NodeType>::Data() {
+        std::vector<Key> data;
+        if (root_ != nullptr) {
+            root_->CollectData(data);
+        }
+        std::sort(data.begin(), data.end());
+        return data;
+    }
+
+    // Destructor
+    template<class Key, class NodeType>
+    BlockedHeap<Key, NodeType>::~BlockedHeap() {
+        if (root_ != nullptr) {
+            delete root_;
+        }
+    }
+
+    // Copy constructor
+    template<class Key, class NodeType>
+    BlockedHeap<Key, NodeType>::BlockedHeap(const BlockedHeap<Key, NodeType> &other) :
+            root_(other.root_ == nullptr ? nullptr : new NodeType(*other.root_)), size_(other.size_) {}
+
+    // Move constructor
+    template<class Key, class NodeType>
+    BlockedHeap<Key, NodeType>::BlockedHeap(BlockedHeap<Key, NodeType> &&other) noexcept : BlockedHeap() {
+        Swap(other);
+    }
+
+    // Copy assignment operator
+    template<class Key, class NodeType>
+    BlockedHeap<Key, NodeType> &BlockedHeap<Key, NodeType>::operator=(const BlockedHeap<Key, NodeType> &other) {
+        if (this != &other) {
+            BlockedHeap tmp(other);
+            Swap(tmp);
+        }
+        return *this;
+    }
+
+    // Move assignment operator
+    template<class Key, class NodeType>
+    BlockedHeap<Key, NodeType> &BlockedHeap<Key, NodeType>::operator=(BlockedHeap<Key, NodeType> &&other) noexcept {
+        if (this != &other) {
+            BlockedHeap tmp(std::move(other));
+            Swap(tmp);
+        }
+        return *this;
+    }
+
+    template<class Key, class NodeType>
+    void BlockedHeap<Key, NodeType>::Swap(BlockedHeap<Key, NodeType> &x) noexcept {
+        std::swap(root_, x.root_);
+        std::swap(size_, x.size_);
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_BLOCKED_HEAP_H
@@ -1,14 +1,23 @@
 #ifndef MERGEABLE_HEAPS_CLASSICAL_HEAP_H
 #define MERGEABLE_HEAPS_CLASSICAL_HEAP_H
 
+#include <vector>
+#include <algorithm>
 #include "mergeable_heaps/exceptions.h"
 #include "heap_interface.h"
+#include "inline_heap.h"
+#include "insert_buffer.h"
+#include "parallel_drain.h"
 #include "nodes/classical_heap_node.h"
 
 namespace heaps {
     // Classical Heap implementation. Key is the type of data stored
     // Leftist and Skew Heaps are based in the ClassicalHeap
-    template<class Key, class NodeType>
+    // Up to InlineCapacity keys are stored in the heap object itself without allocations.
+    // The heap switches to the tree, when there are more keys or it's merged with a tree heap.
+    // With BufferInserts the inserted keys are appended to an unsorted buffer, which is built into a tree
+    // in O(b) and melded once on the next ExtractMinimum or Merge. GetMinimum stays O(1).
+    template<class Key, class NodeType, size_t InlineCapacity = 0, bool BufferInserts = false>
     class ClassicalHeap : public HeapInterface<Key> {
     protected:
         // Link to the root of the tree with the minimal degree.
@@ -16,12 +25,33 @@ namespace heaps {
         NodeType *root_;
         // Number of items in the heap
         size_t size_;
+        // False after the heap is split, Size() recounts the keys then.
+        bool size_valid_;
+        // Keys of the small heap. Not used, when the tree is not empty.
+        [[no_unique_address]] InlineHeap<Key, InlineCapacity> inline_;
+        // Keys inserted since the last extraction or merge
+        [[no_unique_address]] InsertBuffer<Key, BufferInserts> buffer_;
+
+        // Creates the node with a single key
+        static NodeType *NewNode(Key x);
+
+        // Moves the inline keys into the tree.
+        void Promote();
+
+        // Number of nodes in the subtree
+        static size_t CountNodes(NodeType *v);
+
+        // Extracts the keys of the tree v into run in the sorted order, the nodes are deleted one by one.
+        static void DrainTree(NodeType *v, std::vector<Key> &run);
 
         // Methods merges heap "x" to *this heap.
         // heap "x" becomes empty.
         void Merge_(ClassicalHeap &x);
 
     public:
+        // Size of one node of the tree in bytes
+        static constexpr size_t kNodeBytes = sizeof(NodeType);
+
         // Constructor of the empty heap
         ClassicalHeap();
 
@@ -43,7 +73,8 @@ namespace heaps {
         // Throws WrongHeapTypeException, if x is not a BinomialHeap
         void Merge(HeapInterface<Key> &x) override;
 
-        // Return number of items in the heap
+        // Return number of items in the heap.
+        // O(n) for the first call after SplitLeftSubtree, O(1) otherwise.
         size_t Size() override;
 
         // Checks if the heap is empty
@@ -53,122 +84,436 @@ namespace heaps {
         // Now, it's user's responsibility to free node's memory.
         void Detach() override;
 
+        // Returns true, if the keys are stored inline.
+        bool IsInline() const;
+
+        // Number of the keys waiting in the insert buffer
+        size_t BufferedSize() const;
+
+        // Melds the buffered keys into the tree. Called by ExtractMinimum and Merge.
+        void Flush();
+
+        // Detaches the left subtree of the root into a new heap in O(1).
+        // Right subtree takes its place, sizes of both heaps are recounted on the next Size() call.
+        // If the root has no children or the keys are inline, the returned heap is empty.
+        ClassicalHeap SplitLeftSubtree();
+
+        // Adds delta to all the keys in O(1), the delta is pushed down lazily.
+        // Key must support operator+, which keeps the order of the keys.
+        void AddToAll(const Key &delta);
+
+        // Passes all the keys to callback in no particular order and deletes the nodes on the way.
+        // The heap becomes empty. O(n)
+        template<class Callback>
+        void TakeKeys(Callback &&callback);
+
+        // Writes all the keys to out in the order of the repeated ExtractMinimum and returns the end of the output.
+        // The top of the tree is cut off, until there are enough subtrees for the threads. Every subtree is a heap,
+        // so they are drained into sorted runs in parallel, then the runs are merged in parallel.
+        // Nodes are deleted, while they are drained. The heap becomes empty.
+        template<class OutputIt>
+        OutputIt DrainSorted(OutputIt out, size_t threads_cnt);
+
+        // Returns sorted std::vector with all the keys from the heap.
+        // Mainly for debug purposes.
+        std::vector<Key> Data();
+
         //
         // Rule of Five functions
         //
 
         // Destructor. Destructs the heap with all it's nodes
         // Unless they are detached.
-        ~ClassicalHeap<Key, NodeType>();
+        ~ClassicalHeap();
 
         // Copy constructor. Creates the copy of the heap and all it's nodes
-        ClassicalHeap<Key, NodeType>(const ClassicalHeap<Key, NodeType> &other);
+        ClassicalHeap(const ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts> &other);
 
         // Move constructor. Creates the copy of the heap by stealing resources.
         // Other heap is left as newly initialized.
-        ClassicalHeap<Key, NodeType>(ClassicalHeap<Key, NodeType> &&other) noexcept;
+        ClassicalHeap(ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts> &&other) noexcept;
 
         // Copy assignment operator
-        ClassicalHeap<Key, NodeType> &operator=(const ClassicalHeap<Key, NodeType> &other);
+        ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts> &operator=(const ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts> &other);
 
         // Move assignment operator
-        ClassicalHeap<Key, NodeType> &operator=(ClassicalHeap<Key, NodeType> &&other) noexcept;
+        ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts> &operator=(ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts> &&other) noexcept;
 
         // Swap function for "Copy and Swap" idiom
-        void Swap(ClassicalHeap<Key, NodeType> &x) noexcept;
+        void Swap(ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts> &x) noexcept;
     };
 
-    template<class Key, class NodeType>
-    void ClassicalHeap<Key, NodeType>::Insert(Key x) {
-        ClassicalHeap<Key, NodeType> tmp(x);
-        Merge(tmp);
-        // Now tmp is empty and will be destructed.
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    NodeType *ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::NewNode(Key x) {
+        auto *v = new NodeType();
+        v->key_ = x;
+        return v;
     }
 
-    template<class Key, class NodeType>
-    Key ClassicalHeap<Key, NodeType>::GetMinimum() {
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    void ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::Promote() {
+        if constexpr (InlineCapacity > 0) {
+            for (const auto &key: inline_) {
+                root_ = NodeType::Merge_(root_, NewNode(key));
+            }
+            inline_.Clear();
+        }
+    }
+
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    void ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::Insert(Key x) {
+        if constexpr (BufferInserts) {
+            buffer_.Push(x);
+            ++size_;
+            return;
+        }
+        if constexpr (InlineCapacity > 0) {
+            if (root_ == nullptr) {
+                if (!inline_.Full()) {
+                    inline_.Push(x);
+                    ++size_;
+                    return;
+                }
+                Promote();
+            }
+        }
+        root_ = NodeType::Merge_(root_, NewNode(x));
+        ++size_;
+    }
+
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    Key ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::GetMinimum() {
         if (Empty()) {
             throw EmptyHeapException();
-        } else {
-            return root_->key_;
         }
+        if constexpr (BufferInserts) {
+            if (!buffer_.Empty()) {
+                if (root_ != nullptr && root_->key_ < buffer_.Min()) {
+                    return root_->key_;
+                }
+                if constexpr (InlineCapacity > 0) {
+                    if (root_ == nullptr && !inline_.Empty() && inline_.Top() < buffer_.Min()) {
+                        return inline_.Top();
+                    }
+                }
+                return buffer_.Min();
+            }
+        }
+        if constexpr (InlineCapacity > 0) {
+            if (root_ == nullptr) {
+                return inline_.Top();
+            }
+        }
+        return root_->key_;
     }
 
-    template<class Key, class NodeType>
-    void ClassicalHeap<Key, NodeType>::ExtractMinimum() {
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    void ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::ExtractMinimum() {
         if (Empty()) {
             throw EmptyHeapException();
-        } else {
-            NodeType *left = root_->child_left_;
-            NodeType *right = root_->child_right_;
-            root_->Detach();
-            delete root_;
-            root_ = NodeType::Merge_(left, right);
         }
+        Flush();
+        if constexpr (InlineCapacity > 0) {
+            if (root_ == nullptr) {
+                inline_.Pop();
+                --size_;
+                return;
+            }
+        }
+        root_->PushDown();
+        NodeType *left = root_->child_left_;
+        NodeType *right = root_->child_right_;
+        root_->Detach();
+        delete root_;
+        root_ = NodeType::Merge_(left, right);
+        --size_;
     }
 
-    template<class Key, class NodeType>
-    void ClassicalHeap<Key, NodeType>::Merge(HeapInterface<Key> &x) {
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    void ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::Merge(HeapInterface<Key> &x) {
         if (&x == this) {
             throw SelfHeapMergeException();
         }
         try {
-            Merge_(dynamic_cast<ClassicalHeap<Key, NodeType> &>(x));
+            Merge_(dynamic_cast<ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts> &>(x));
             x.Detach();
         } catch (const std::bad_cast &e) {
             throw WrongHeapTypeException();
         }
     }
 
-    template<class Key, class NodeType>
-    size_t ClassicalHeap<Key, NodeType>::Size() {
-        return Empty() ? 0 : size_;
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    size_t ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::Size() {
+        if (!size_valid_) {
+            size_ = CountNodes(root_) + inline_.Size() + buffer_.Size();
+            size_valid_ = true;
+        }
+        return size_;
+    }
+
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    size_t ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::CountNodes(NodeType *v) {
+        size_t count = 0;
+        std::vector<NodeType *> stack;
+        if (v != nullptr) {
+            stack.push_back(v);
+        }
+        while (!stack.empty()) {
+            v = stack.back();
+            stack.pop_back();
+            ++count;
+            for (NodeType *child: {v->child_left_, v->child_right_}) {
+                if (child != nullptr) {
+                    stack.push_back(child);
+                }
+            }
+        }
+        return count;
+    }
+
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    bool ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::Empty() {
+        return root_ == nullptr && inline_.Empty() && buffer_.Empty();
     }
 
-    template<class Key, class NodeType>
-    bool ClassicalHeap<Key, NodeType>::Empty() {
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    bool ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::IsInline() const {
         return root_ == nullptr;
     }
 
-    template<class Key, class NodeType>
-    void ClassicalHeap<Key, NodeType>::Merge_(ClassicalHeap &x) {
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    size_t ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::BufferedSize() const {
+        return buffer_.Size();
+    }
+
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    void ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::Flush() {
+        if constexpr (BufferInserts) {
+            if (buffer_.Empty()) {
+                return;
+            }
+            if constexpr (InlineCapacity > 0) {
+                if (root_ == nullptr && inline_.Size() + buffer_.Size() <= InlineCapacity) {
+                    for (const auto &key: buffer_) {
+                        inline_.Push(key);
+                    }
+                    buffer_.Clear();
+                    return;
+                }
+                Promote();
+            }
+            // The one-node trees are melded pairwise in rounds: b/2 melds of size 1, b/4 of size 2 and so on,
+            // which is O(b) for the leftist and skew trees.
+            std::vector<NodeType *> trees;
+            trees.reserve(buffer_.Size());
+            for (const auto &key: buffer_) {
+                trees.push_back(NewNode(key));
+            }
+            while (trees.size() > 1) {
+                size_t melded = 0;
+                for (size_t i = 0; i + 1 < trees.size(); i += 2) {
+                    trees[melded++] = NodeType::Merge_(trees[i], trees[i + 1]);
+                }
+                if (trees.size() % 2 == 1) {
+                    trees[melded++] = trees.back();
+                }
+                trees.resize(melded);
+            }
+            root_ = NodeType::Merge_(root_, trees[0]);
+            buffer_.Clear();
+        }
+    }
+
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    void ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::AddToAll(const Key &delta) {
+        static_assert(kAdditiveKey<Key>, "AddToAll requires keys with operator+");
+        if (root_ != nullptr) {
+            root_->AddToSubtree(delta);
+        }
+        inline_.AddToAll(delta);
+        buffer_.AddToAll(delta);
+    }
+
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    void ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::Merge_(ClassicalHeap &x) {
+        Flush();
+        x.Flush();
+        if constexpr (InlineCapacity > 0) {
+            // Small heaps stay inline, while they fit.
+            if (root_ == nullptr && x.root_ == nullptr && inline_.Size() + x.inline_.Size() <= InlineCapacity) {
+                for (const auto &key: x.inline_) {
+                    inline_.Push(key);
+                }
+                size_ += x.size_;
+                size_valid_ = size_valid_ && x.size_valid_;
+                return;
+            }
+            Promote();
+            x.Promote();
+        }
         root_ = NodeType::Merge_(root_, x.root_);
+        size_ += x.size_;
+        size_valid_ = size_valid_ && x.size_valid_;
     }
 
-    template<class Key, class NodeType>
-    ClassicalHeap<Key, NodeType>::ClassicalHeap() : root_(nullptr), size_(0) {}
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts> ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::SplitLeftSubtree() {
+        ClassicalHeap stolen;
+        Flush();
+        if (root_ == nullptr || root_->child_left_ == nullptr) {
+            return stolen;
+        }
+        root_->PushDown();
+        stolen.root_ = root_->child_left_;
+        root_->child_left_ = root_->child_right_;
+        root_->child_right_ = nullptr;
+        root_->UpdateRank();
+        stolen.size_valid_ = size_valid_ = false;
+        return stolen;
+    }
 
-    template<class Key, class NodeType>
-    void ClassicalHeap<Key, NodeType>::Detach() {
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::ClassicalHeap() : root_(nullptr), size_(0), size_valid_(true) {}
+
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    void ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::Detach() {
         root_ = nullptr;
         size_ = 0;
+        size_valid_ = true;
+        inline_.Clear();
+        buffer_.Clear();
+    }
+
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    template<class Callback>
+    void ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::TakeKeys(Callback &&callback) {
+        for (const auto &key: inline_) {
+            callback(key);
+        }
+        for (const auto &key: buffer_) {
+            callback(key);
+        }
+        std::vector<NodeType *> stack;
+        if (root_ != nullptr) {
+            stack.push_back(root_);
+        }
+        while (!stack.empty()) {
+            NodeType *v = stack.back();
+            stack.pop_back();
+            v->PushDown();
+            for (NodeType *child: {v->child_left_, v->child_right_}) {
+                if (child != nullptr) {
+                    stack.push_back(child);
+                }
+            }
+            callback(v->key_);
+            v->Detach();
+            delete v;
+        }
+        Detach();
+    }
+
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    void ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::DrainTree(NodeType *v, std::vector<Key> &run) {
+        while (v != nullptr) {
+            v->PushDown();
+            run.push_back(v->key_);
+            NodeType *left = v->child_left_;
+            NodeType *right = v->child_right_;
+            v->Detach();
+            delete v;
+            v = NodeType::Merge_(left, right);
+        }
+    }
+
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    template<class OutputIt>
+    OutputIt ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::DrainSorted(OutputIt out, size_t threads_cnt) {
+        threads_cnt = std::max<size_t>(threads_cnt, 1);
+        // The inline and the buffered keys are sorted as they are.
+        std::vector<std::vector<Key>> runs(2);
+        runs[0].assign(inline_.begin(), inline_.end());
+        runs[0].insert(runs[0].end(), buffer_.begin(), buffer_.end());
+        std::sort(runs[0].begin(), runs[0].end());
+        // Breadth-first cut of the top, pieces[expanded..] are the subtrees left.
+        // A few subtrees per thread even out the unknown sizes.
+        const size_t pieces_cnt = threads_cnt == 1 ? 1 : 8 * threads_cnt;
+        std::vector<NodeType *> pieces;
+        if (root_ != nullptr) {
+            pieces.push_back(root_);
+        }
+        size_t expanded = 0;
+        for (; expanded < pieces.size() && pieces.size() - expanded < pieces_cnt; ++expanded) {
+            NodeType *v = pieces[expanded];
+            v->PushDown();
+            runs[1].push_back(v->key_);
+            for (NodeType *child: {v->child_left_, v->child_right_}) {
+                if (child != nullptr) {
+                    pieces.push_back(child);
+                }
+            }
+            v->Detach();
+            delete v;
+        }
+        std::sort(runs[1].begin(), runs[1].end());
+        pieces.erase(pieces.begin(), pieces.begin() + static_cast<std::ptrdiff_t>(expanded));
+        Detach();
+        runs.resize(2 + pieces.size());
+        detail::ParallelFor(pieces.size(), threads_cnt, [&](size_t i) {
+            DrainTree(pieces[i], runs[2 + i]);
+        });
+        return detail::MergeRuns(runs, out, threads_cnt);
+    }
+
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    std::vector<Key> ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::Data() {
+        std::vector<Key> data(inline_.begin(), inline_.end());
+        data.insert(data.end(), buffer_.begin(), buffer_.end());
+        std::vector<NodeType *> stack;
+        if (root_ != nullptr) {
+            stack.push_back(root_);
+        }
+        while (!stack.empty()) {
+            NodeType *v = stack.back();
+            stack.pop_back();
+            data.push_back(v->key_);
+            v->PushDown();
+            for (NodeType *child: {v->child_left_, v->child_right_}) {
+                if (child != nullptr) {
+                    stack.push_back(child);
+                }
+            }
+        }
+        std::sort(data.begin(), data.end());
+        return data;
     }
 
     // Destructor
-    template<class Key, class NodeType>
-    ClassicalHeap<Key, NodeType>::~ClassicalHeap<Key, NodeType>() {
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::~ClassicalHeap() {
         if (root_ != nullptr) {
             delete root_;
         }
     }
 
     // Copy constructor
-    template<class Key, class NodeType>
-    ClassicalHeap<Key, NodeType>::ClassicalHeap(const ClassicalHeap<Key, NodeType> &other) : size_(other.size_),
-                                                                                             root_(new ClassicalHeapNode<Key, NodeType>(
-                                                                                                     *other.root_)) {}
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::ClassicalHeap(const ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts> &other) : root_(other.root_ == nullptr ? nullptr : new NodeType(*other.root_)),
+                                         size_(other.size_), size_valid_(other.size_valid_),
+                                         inline_(other.inline_), buffer_(other.buffer_) {}
 
     // Move constructor
-    template<class Key, class NodeType>
-    ClassicalHeap<Key, NodeType>::ClassicalHeap(ClassicalHeap<Key, NodeType> &&other) noexcept {
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::ClassicalHeap(ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts> &&other) noexcept {
         root_ = nullptr;
         size_ = 0;
+        size_valid_ = true;
         Swap(other);
     }
 
     // Copy assignment operator
-    template<class Key, class NodeType>
-    ClassicalHeap<Key, NodeType> &ClassicalHeap<Key, NodeType>::operator=(const ClassicalHeap<Key, NodeType> &other) {
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts> &ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::operator=(const ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts> &other) {
         if (this != &other) {
             ClassicalHeap tmp(other);
             Swap(tmp);
@@ -177,28 +522,27 @@ namespace heaps {
     }
 
     // Move assignment operator
-    template<class Key, class NodeType>
-    ClassicalHeap<Key, NodeType> &
-    ClassicalHeap<Key, NodeType>::operator=(ClassicalHeap<Key, NodeType> &&other) noexcept {
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts> &ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::operator=(ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts> &&other) noexcept {
         if (this != &other) {
-            root_ = nullptr;
-            size_ = 0;
-            Swap(other);
+            ClassicalHeap tmp(std::move(other));
+            Swap(tmp);
         }
         return *this;
     }
 
-    template<class Key, class NodeType>
-    void ClassicalHeap<Key, NodeType>::Swap(ClassicalHeap<Key, NodeType> &x) noexcept {
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    void ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::Swap(ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts> &x) noexcept {
         std::swap(root_, x.root_);
         std::swap(size_, x.size_);
+        std::swap(size_valid_, x.size_valid_);
+        inline_.Swap(x.inline_);
+        buffer_.Swap(x.buffer_);
     }
 
-    template<class Key, class NodeType>
-    ClassicalHeap<Key, NodeType>::ClassicalHeap(Key x) {
-        root_ = new NodeType();
-        size_ = 1;
-        root_->key_ = x;
+    template<class Key, class NodeType, size_t InlineCapacity, bool BufferInserts>
+    ClassicalHeap<Key, NodeType, InlineCapacity, BufferInserts>::ClassicalHeap(Key x) : ClassicalHeap() {
+        Insert(x);
     }
 } // namespace heaps
 
@@ -0,0 +1,165 @@
+#ifndef MERGEABLE_HEAPS_INLINE_HEAP_H
+#define MERGEABLE_HEAPS_INLINE_HEAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace heaps {
+    // Tiny binary heap stored in a fixed array, used as a small-buffer mode of the mergeable heaps.
+    // Tree heaps keep their first Capacity keys here and allocate nodes only after that.
+    // Key must be default constructible.
+    template<class Key, size_t Capacity>
+    class InlineHeap {
+    public:
+        static_assert(Capacity <= UINT32_MAX, "Inline capacity is too large");
+
+        InlineHeap();
+
+        bool Empty() const;
+
+        bool Full() const;
+
+        size_t Size() const;
+
+        // Returns the minimal key. Heap must not be empty.
+        const Key &Top() const;
+
+        // Inserts the key. Heap must not be full.
+        void Push(Key key);
+
+        // Removes the minimal key. Heap must not be empty.
+        void Pop();
+
+        // Removes all the keys.
+        void Clear();
+
+        // Adds delta to every key, the order is kept.
+        void AddToAll(const Key &delta);
+
+        // Keys in no particular order
+        const Key *begin() const;
+
+        const Key *end() const;
+
+        void Swap(InlineHeap &x) noexcept;
+
+    private:
+        Key keys_[Capacity];
+        uint32_t size_;
+    };
+
+    // Without the inline storage the heap is always empty and full.
+    template<class Key>
+    class InlineHeap<Key, 0> {
+    public:
+        bool Empty() const { return true; }
+
+        bool Full() const { return true; }
+
+        size_t Size() const { return 0; }
+
+        void Clear() {}
+
+        void AddToAll(const Key &) {}
+
+        const Key *begin() const { return nullptr; }
+
+        const Key *end() const { return nullptr; }
+
+        void Swap(InlineHeap &) noexcept {}
+    };
+
+    template<class Key, size_t Capacity>
+    InlineHeap<Key, Capacity>::InlineHeap() : keys_(), size_(0) {}
+
+    template<class Key, size_t Capacity>
+    bool InlineHeap<Key, Capacity>::Empty() const {
+        return size_ == 0;
+    }
+
+    template<class Key, size_t Capacity>
+    bool InlineHeap<Key, Capacity>::Full() const {
+        return size_ == Capacity;
+    }
+
+    template<class Key, size_t Capacity>
+    size_t InlineHeap<Key, Capacity>::Size() const {
+        return size_;
+    }
+
+    template<class Key, size_t Capacity>
+    const Key &InlineHeap<Key, Capacity>::Top() const {
+        return keys_[0];
+    }
+
+    template<class Key, size_t Capacity>
+    void InlineHeap<Key, Capacity>::Push(Key key) {
+        size_t i = size_++;
+        while (i > 0 && key < keys_[(i - 1) / 2]) {
+            keys_[i] = std::move(keys_[(i - 1) / 2]);
+            i = (i - 1) / 2;
+        }
+        keys_[i] = std::move(key);
+    }
+
+    template<class Key, size_t Capacity>
+    void InlineHeap<Key, Capacity>::Pop() {
+        Key last = std::move(keys_[--size_]);
+        size_t i = 0;
+        // size_ never exceeds Capacity, the second bound only lets the compiler see it.
+        while (2 * i + 1 < size_ && 2 * i + 1 < Capacity) {
+            size_t child = 2 * i + 1;
+            if (child + 1 < size_ && child + 1 < Capacity && keys_[child + 1] < keys_[child]) {
+                ++child;
+            }
+            if (!(keys_[child] < last)) {
+                break;
+            }
+            keys_[i] = std::move(keys_[child]);
+            i = child;
+        }
+        if (size_ > 0) {
+            keys_[i] = std::move(last);
+        }
+    }
+
+    template<class Key, size_t Capacity>
+    void InlineHeap<Key, Capacity>::Clear() {
+        size_ = 0;
+    }
+
+    template<class Key, size_t Capacity>
+    void InlineHeap<Key, Capacity>::AddToAll(const Key &delta) {
+        for (uint32_t i = 0; i < size_; ++i) {
+            keys_[i] = keys_[i] + delta;
+        }
+    }
+
+    template<class Key, size_t Capacity>
+    const Key *InlineHeap<Key, Capacity>::begin() const {
+        return keys_;
+    }
+
+    template<class Key, size_t Capacity>
+    const Key *InlineHeap<Key, Capacity>::end() const {
+        return keys_ + size_;
+    }
+
+    template<class Key, size_t Capacity>
+    void InlineHeap<Key, Capacity>::Swap(InlineHeap &x) noexcept {
+        // Only the live keys are moved, the rest of the arrays is stale.
+        InlineHeap &larger = size_ < x.size_ ? x : *this;
+        InlineHeap &smaller = size_ < x.size_ ? *this : x;
+        uint32_t i = 0;
+        for (; i < smaller.size_; ++i) {
+            std::swap(keys_[i], x.keys_[i]);
+        }
+        for (; i < larger.size_ && i < Capacity; ++i) {
+            smaller.keys_[i] = std::move(larger.keys_[i]);
+        }
+        std::swap(size_, x.size_);
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_INLINE_HEAP_H
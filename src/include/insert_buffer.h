@@ -0,0 +1,116 @@
+#ifndef MERGEABLE_HEAPS_INSERT_BUFFER_H
+#define MERGEABLE_HEAPS_INSERT_BUFFER_H
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace heaps {
+    // Unsorted buffer of the inserted keys, used as the insert-buffer mode of the mergeable heaps.
+    // The heaps meld the buffer at once on the next extraction or merge, its minimum is tracked,
+    // so the minimum of the heap is known without melding.
+    template<class Key, bool Enabled>
+    class InsertBuffer {
+    public:
+        bool Empty() const;
+
+        size_t Size() const;
+
+        // Returns the minimal key. Buffer must not be empty.
+        const Key &Min() const;
+
+        // Appends the key. O(1) amortized
+        void Push(Key key);
+
+        // Removes all the keys, the memory is kept for the next burst.
+        void Clear();
+
+        // Adds delta to every key, the order is kept.
+        void AddToAll(const Key &delta);
+
+        // Keys in the order of insertion
+        const Key *begin() const;
+
+        const Key *end() const;
+
+        void Swap(InsertBuffer &x) noexcept;
+
+    private:
+        std::vector<Key> keys_;
+        // Index of the minimal key
+        size_t min_ = 0;
+    };
+
+    // Without the buffer the keys are melded at once.
+    template<class Key>
+    class InsertBuffer<Key, false> {
+    public:
+        bool Empty() const { return true; }
+
+        size_t Size() const { return 0; }
+
+        void Clear() {}
+
+        void AddToAll(const Key &) {}
+
+        const Key *begin() const { return nullptr; }
+
+        const Key *end() const { return nullptr; }
+
+        void Swap(InsertBuffer &) noexcept {}
+    };
+
+    template<class Key, bool Enabled>
+    bool InsertBuffer<Key, Enabled>::Empty() const {
+        return keys_.empty();
+    }
+
+    template<class Key, bool Enabled>
+    size_t InsertBuffer<Key, Enabled>::Size() const {
+        return keys_.size();
+    }
+
+    template<class Key, bool Enabled>
+    const Key &InsertBuffer<Key, Enabled>::Min() const {
+        return keys_[min_];
+    }
+
+    template<class Key, bool Enabled>
+    void InsertBuffer<Key, Enabled>::Push(Key key) {
+        keys_.push_back(std::move(key));
+        if (keys_.size() == 1 || keys_.back() < keys_[min_]) {
+            min_ = keys_.size() - 1;
+        }
+    }
+
+    template<class Key, bool Enabled>
+    void InsertBuffer<Key, Enabled>::Clear() {
+        keys_.clear();
+        min_ = 0;
+    }
+
+    template<class Key, bool Enabled>
+    void InsertBuffer<Key, Enabled>::AddToAll(const Key &delta) {
+        for (auto &key: keys_) {
+            key = key + delta;
+        }
+    }
+
+    template<class Key, bool Enabled>
+    const Key *InsertBuffer<Key, Enabled>::begin() const {
+        return keys_.data();
+    }
+
+    template<class Key, bool Enabled>
+    const Key *InsertBuffer<Key, Enabled>::end() const {
+        return keys_.data() + keys_.size();
+    }
+
+    template<class Key, bool Enabled>
+    void InsertBuffer<Key, Enabled>::Swap(InsertBuffer &x) noexcept {
+        keys_.swap(x.keys_);
+        std::swap(min_, x.min_);
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_INSERT_BUFFER_H
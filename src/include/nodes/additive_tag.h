@@ -0,0 +1,43 @@
+#ifndef MERGEABLE_HEAPS_ADDITIVE_TAG_H
+#define MERGEABLE_HEAPS_ADDITIVE_TAG_H
+
+#include <string>
+#include <utility>
+#include <type_traits>
+
+namespace heaps {
+    namespace detail {
+        template<class Key, class = void>
+        struct HasAddition : std::false_type {};
+
+        template<class Key>
+        struct HasAddition<Key, std::void_t<decltype(std::declval<const Key &>() + std::declval<const Key &>())>>
+                : std::is_convertible<decltype(std::declval<const Key &>() + std::declval<const Key &>()), Key> {};
+    } // namespace detail
+
+    // Tells, if keys of the type may be shifted by a constant with operator+.
+    // Shifting must keep the order: a < b implies a + d < b + d.
+    // Detected automatically, specialize it to opt out.
+    template<class Key>
+    struct AdditiveKey : detail::HasAddition<Key> {};
+
+    // Concatenation doesn't keep the order.
+    template<class Char, class Traits, class Allocator>
+    struct AdditiveKey<std::basic_string<Char, Traits, Allocator>> : std::false_type {};
+
+    template<class Key>
+    constexpr bool kAdditiveKey = AdditiveKey<Key>::value;
+
+    // Lazy delta, which is to be added to all the keys below the node.
+    // Key() is the neutral element. Empty for the keys without addition.
+    template<class Key, bool Enabled = kAdditiveKey<Key>>
+    class AdditiveTag {
+    public:
+        Key delta_{};
+    };
+
+    template<class Key>
+    class AdditiveTag<Key, false> {};
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_ADDITIVE_TAG_H
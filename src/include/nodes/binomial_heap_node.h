@@ -1,6 +1,8 @@
 #ifndef MERGEABLE_HEAPS_BINOMIAL_HEAP_NODE_H
 #define MERGEABLE_HEAPS_BINOMIAL_HEAP_NODE_H
 
+#include <vector>
+
 namespace heaps {
     // One node of the Binomial Heap. Key is the type of data stored
     template<class Key>
@@ -56,6 +58,11 @@ namespace heaps {
         // Recursively scarabs data from the vertex and its children to the std::vector
         void CollectData(std::vector<Key> &x);
 
+        // Passes the keys of the tree v, its siblings included, to callback in no particular order.
+        // Nodes are deleted on the way. O(n)
+        template<class Callback>
+        static void TakeKeys(BinomialHeapNode *v, Callback &&callback);
+
         // Detaches the vertex from its neighbours, while
         // not destroying them.
         void Detach();
@@ -151,6 +158,27 @@ namespace heaps {
         }
     }
 
+    template<class Key>
+    template<class Callback>
+    void BinomialHeapNode<Key>::TakeKeys(BinomialHeapNode *v, Callback &&callback) {
+        std::vector<BinomialHeapNode *> stack;
+        if (v != nullptr) {
+            stack.push_back(v);
+        }
+        while (!stack.empty()) {
+            v = stack.back();
+            stack.pop_back();
+            for (BinomialHeapNode *next: {v->child_, v->sibling_}) {
+                if (next != nullptr) {
+                    stack.push_back(next);
+                }
+            }
+            callback(v->key_);
+            v->Detach();
+            delete v;
+        }
+    }
+
     template<class Key>
     void BinomialHeapNode<Key>::Detach() {
         parent_ = sibling_ = child_ = nullptr;
@@ -0,0 +1,159 @@
+#ifndef MERGEABLE_HEAPS_BLOCKED_HEAP_NODE_H
+#define MERGEABLE_HEAPS_BLOCKED_HEAP_NODE_H
+
+#include <utility>
+#include <vector>
+#include "key_block.h"
+
+namespace heaps {
+    // Base class for nodes of the blocked heaps, which store a block of keys in each node.
+    // Heap order is kept between blocks: every key of the node is not greater
+    // than any key of its children.
+    template<class Key, size_t Capacity, class Derived>
+    class BlockedHeapNode {
+    public:
+        // Keys stored in the node. Not empty for the nodes in the heap.
+        KeyBlock<Key, Capacity> keys_;
+        // Pointers to its children. Equal to nullptr, if there is none.
+        Derived *child_left_;
+        Derived *child_right_;
+
+        // Simple constructors
+        BlockedHeapNode();
+
+        explicit BlockedHeapNode(Key key);
+
+        // Returns true, if the key may be stored in the node without breaking
+        // the order with its children.
+        bool FitsAboveChildren(const Key &key) const;
+
+        // Splits the node, so that none of its keys is greater than "value".
+        // Greater keys are moved to the new node, which is returned. If there are none, returns nullptr.
+        static Derived *SplitAbove(Derived *v, const Key &value);
+
+        // Recursively collects keys from the node and its children to the std::vector
+        void CollectData(std::vector<Key> &x) const;
+
+        // Detaches the node from all the others.
+        // Children of the detached vertex won't be destroyed after their parent is destroyed.
+        void Detach();
+
+        //
+        // Rule of Five functions
+        //
+
+        // Destructor. Destructs the node and it's subtree.
+        ~BlockedHeapNode();
+
+        // Copy constructor. Creates the copy of the vertex and it's subtree.
+        BlockedHeapNode(const BlockedHeapNode &other);
+
+        // Move constructor. Creates the copy of the vertex by stealing resources.
+        // Other vertex is left as newly initialized.
+        BlockedHeapNode(BlockedHeapNode &&other) noexcept;
+
+        // Copy assignment operator
+        BlockedHeapNode &operator=(const BlockedHeapNode &other);
+
+        // Move assignment operator
+        BlockedHeapNode &operator=(BlockedHeapNode &&other) noexcept;
+
+        // Swap function for "Copy and Swap" idiom
+        void Swap(BlockedHeapNode &x) noexcept;
+    };
+
+    template<class Key, size_t Capacity, class Derived>
+    BlockedHeapNode<Key, Capacity, Derived>::BlockedHeapNode() : child_left_(nullptr), child_right_(nullptr) {}
+
+    template<class Key, size_t Capacity, class Derived>
+    BlockedHeapNode<Key, Capacity, Derived>::BlockedHeapNode(Key key) :
+            keys_(key), child_left_(nullptr), child_right_(nullptr) {}
+
+    template<class Key, size_t Capacity, class Derived>
+    bool BlockedHeapNode<Key, Capacity, Derived>::FitsAboveChildren(const Key &key) const {
+        return (child_left_ == nullptr || !(child_left_->keys_.Min() < key)) &&
+               (child_right_ == nullptr || !(child_right_->keys_.Min() < key));
+    }
+
+    template<class Key, size_t Capacity, class Derived>
+    Derived *BlockedHeapNode<Key, Capacity, Derived>::SplitAbove(Derived *v, const Key &value) {
+        if (v->keys_.GreaterMask(value) == 0) {
+            return nullptr;
+        }
+        auto *spilled = new Derived();
+        v->keys_.MoveGreater(value, spilled->keys_);
+        return spilled;
+    }
+
+    template<class Key, size_t Capacity, class Derived>
+    void BlockedHeapNode<Key, Capacity, Derived>::CollectData(std::vector<Key> &x) const {
+        x.insert(x.end(), keys_.keys_, keys_.keys_ + keys_.size_);
+        if (child_left_ != nullptr) {
+            child_left_->CollectData(x);
+        }
+        if (child_right_ != nullptr) {
+            child_right_->CollectData(x);
+        }
+    }
+
+    template<class Key, size_t Capacity, class Derived>
+    void BlockedHeapNode<Key, Capacity, Derived>::Detach() {
+        child_left_ = child_right_ = nullptr;
+    }
+
+    template<class Key, size_t Capacity, class Derived>
+    BlockedHeapNode<Key, Capacity, Derived>::~BlockedHeapNode() {
+        if (child_left_ != nullptr) {
+            delete child_left_;
+        }
+        if (child_right_ != nullptr) {
+            delete child_right_;
+        }
+    }
+
+    template<class Key, size_t Capacity, class Derived>
+    BlockedHeapNode<Key, Capacity, Derived>::BlockedHeapNode(const BlockedHeapNode &other) :
+            keys_(other.keys_), child_left_(other.child_left_), child_right_(other.child_right_) {
+        if (child_left_ != nullptr) {
+            child_left_ = new Derived(*child_left_);
+        }
+        if (child_right_ != nullptr) {
+            child_right_ = new Derived(*child_right_);
+        }
+    }
+
+    template<class Key, size_t Capacity, class Derived>
+    BlockedHeapNode<Key, Capacity, Derived>::BlockedHeapNode(BlockedHeapNode &&other) noexcept :
+            BlockedHeapNode() {
+        Swap(other);
+    }
+
+    template<class Key, size_t Capacity, class Derived>
+    BlockedHeapNode<Key, Capacity, Derived> &
+    BlockedHeapNode<Key, Capacity, Derived>::operator=(const BlockedHeapNode &other) {
+        if (this != &other) {
+            BlockedHeapNode tmp(other);
+            Swap(tmp);
+        }
+        return *this;
+    }
+
+    template<class Key, size_t Capacity, class Derived>
+    BlockedHeapNode<Key, Capacity, Derived> &
+    BlockedHeapNode<Key, Capacity, Derived>::operator=(BlockedHeapNode &&other) noexcept {
+        if (this != &other) {
+            BlockedHeapNode tmp(std::move(other));
+            Swap(tmp);
+        }
+        return *this;
+    }
+
+    template<class Key, size_t Capacity, class Derived>
+    void BlockedHeapNode<Key, Capacity, Derived>::Swap(BlockedHeapNode &x) noexcept {
+        std::swap(keys_, x.keys_);
+        std::swap(child_left_, x.child_left_);
+        std::swap(child_right_, x.child_right_);
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_BLOCKED_HEAP_NODE_H
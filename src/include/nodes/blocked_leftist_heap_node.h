@@ -0,0 +1,69 @@
+#ifndef MERGEABLE_HEAPS_BLOCKED_LEFTIST_HEAP_NODE_H
+#define MERGEABLE_HEAPS_BLOCKED_LEFTIST_HEAP_NODE_H
+
+#include <algorithm>
+#include "blocked_heap_node.h"
+
+namespace heaps {
+    // One node of the blocked Leftist Heap
+    // Specifies the BlockedHeapNode class
+    template<class Key, size_t Capacity>
+    class BlockedLeftistHeapNode : public BlockedHeapNode<Key, Capacity, BlockedLeftistHeapNode<Key, Capacity>> {
+    public:
+        using Base = BlockedHeapNode<Key, Capacity, BlockedLeftistHeapNode<Key, Capacity>>;
+        // Rank is length of the shortest path from node to the leaf.
+        size_t rank_;
+
+        // Primitive constructors
+        BlockedLeftistHeapNode();
+
+        explicit BlockedLeftistHeapNode(Key key);
+
+        // Method updates rank_ value by updating it using the children value.
+        void UpdateRank();
+
+        // Merges 2 subtrees and returns the result. Steals resources from root_1, root_2
+        static BlockedLeftistHeapNode *Merge_(BlockedLeftistHeapNode *root_1, BlockedLeftistHeapNode *root_2);
+    };
+
+    template<class Key, size_t Capacity>
+    BlockedLeftistHeapNode<Key, Capacity>::BlockedLeftistHeapNode() : Base(), rank_(1) {}
+
+    template<class Key, size_t Capacity>
+    BlockedLeftistHeapNode<Key, Capacity>::BlockedLeftistHeapNode(Key key) : Base(key), rank_(1) {}
+
+    template<class Key, size_t Capacity>
+    void BlockedLeftistHeapNode<Key, Capacity>::UpdateRank() {
+        rank_ = 1 + std::min(
+                (Base::child_left_ == nullptr ? 0 : Base::child_left_->rank_),
+                (Base::child_right_ == nullptr ? 0 : Base::child_right_->rank_)
+        );
+    }
+
+    template<class Key, size_t Capacity>
+    BlockedLeftistHeapNode<Key, Capacity> *
+    BlockedLeftistHeapNode<Key, Capacity>::Merge_(BlockedLeftistHeapNode *root_1, BlockedLeftistHeapNode *root_2) {
+        if (root_1 == nullptr || root_2 == nullptr) {
+            return root_1 == nullptr ? root_2 : root_1;
+        }
+        if (!(root_1->keys_.Min() < root_2->keys_.Min())) {
+            std::swap(root_1, root_2);
+        }
+        // Keys of root_1 greater than the minimum of root_2 can't stay above it.
+        BlockedLeftistHeapNode *spilled = Base::SplitAbove(root_1, root_2->keys_.Min());
+        if (spilled != nullptr) {
+            root_2 = Merge_(root_2, spilled);
+        }
+
+        root_1->child_right_ = Merge_(root_1->child_right_, root_2);
+
+        if (root_1->child_left_ == nullptr || root_1->child_left_->rank_ < root_1->child_right_->rank_) {
+            std::swap(root_1->child_left_, root_1->child_right_);
+        }
+        root_1->UpdateRank();
+
+        return root_1;
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_BLOCKED_LEFTIST_HEAP_NODE_H
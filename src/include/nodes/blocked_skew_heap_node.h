@@ -0,0 +1,40 @@
+#ifndef MERGEABLE_HEAPS_BLOCKED_SKEW_HEAP_NODE_H
+#define MERGEABLE_HEAPS_BLOCKED_SKEW_HEAP_NODE_H
+
+#include "blocked_heap_node.h"
+
+namespace heaps {
+    // One node of the blocked skew heap, specifies BlockedHeapNode.
+    template<class Key, size_t Capacity>
+    class BlockedSkewHeapNode : public BlockedHeapNode<Key, Capacity, BlockedSkewHeapNode<Key, Capacity>> {
+    public:
+        using Base = BlockedHeapNode<Key, Capacity, BlockedSkewHeapNode<Key, Capacity>>;
+        // Importing Base's constructors
+        using Base::Base;
+
+        // Merges two subtrees and returns the result. "Steals" resources from root_1, root_2.
+        static BlockedSkewHeapNode *Merge_(BlockedSkewHeapNode *root_1, BlockedSkewHeapNode *root_2);
+    };
+
+    template<class Key, size_t Capacity>
+    BlockedSkewHeapNode<Key, Capacity> *
+    BlockedSkewHeapNode<Key, Capacity>::Merge_(BlockedSkewHeapNode *root_1, BlockedSkewHeapNode *root_2) {
+        if (root_1 == nullptr || root_2 == nullptr) {
+            return root_1 == nullptr ? root_2 : root_1;
+        }
+        if (!(root_1->keys_.Min() < root_2->keys_.Min())) {
+            std::swap(root_1, root_2);
+        }
+        // Keys of root_1 greater than the minimum of root_2 can't stay above it.
+        BlockedSkewHeapNode *spilled = Base::SplitAbove(root_1, root_2->keys_.Min());
+        if (spilled != nullptr) {
+            root_2 = Merge_(root_2, spilled);
+        }
+        BlockedSkewHeapNode *tmp_root = root_1->child_right_;
+        std::swap(root_1->child_left_, root_1->child_right_);
+        root_1->child_left_ = Merge_(tmp_root, root_2);
+        return root_1;
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_BLOCKED_SKEW_HEAP_NODE_H
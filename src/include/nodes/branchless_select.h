@@ -0,0 +1,30 @@
+#ifndef MERGEABLE_HEAPS_BRANCHLESS_SELECT_H
+#define MERGEABLE_HEAPS_BRANCHLESS_SELECT_H
+
+#include <cstdint>
+#include <type_traits>
+
+namespace heaps {
+    // Tells, if the leftist and skew merges choose the root and order the children without branches.
+    // The conditional moves save the mispredictions of the random comparisons, but the next node can't be
+    // loaded before the comparison is done, so on the heaps out of cache it's usually slower.
+    // Off by default, specialize it to opt in for the keys with a cheap operator<, e.g. the arithmetic ones.
+    template<class Key>
+    struct BranchlessKey : std::false_type {};
+
+    template<class Key>
+    constexpr bool kBranchlessKey = BranchlessKey<Key>::value;
+
+    namespace detail {
+        // Swaps the pointers, if condition is true. The pointers are xor-ed under a mask, so there is no branch.
+        template<class T>
+        inline void SwapIf(bool condition, T *&a, T *&b) {
+            const uintptr_t mask = (reinterpret_cast<uintptr_t>(a) ^ reinterpret_cast<uintptr_t>(b)) &
+                                   (uintptr_t(0) - static_cast<uintptr_t>(condition));
+            a = reinterpret_cast<T *>(reinterpret_cast<uintptr_t>(a) ^ mask);
+            b = reinterpret_cast<T *>(reinterpret_cast<uintptr_t>(b) ^ mask);
+        }
+    } // namespace detail
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_BRANCHLESS_SELECT_H
@@ -1,11 +1,15 @@
 #ifndef MERGEABLE_HEAPS_CLASSICAL_HEAP_NODE_H
 #define MERGEABLE_HEAPS_CLASSICAL_HEAP_NODE_H
 
+#include <utility>
+#include "additive_tag.h"
+
 namespace heaps {
 // Base class for nodes of simple Mergeable heaps, such as
 // leftist heap and skew heap.
+    // For the keys with addition the node stores a lazy delta for its subtree.
     template<class Key, class Derived>
-    class ClassicalHeapNode {
+    class ClassicalHeapNode : public AdditiveTag<Key> {
     public:
         // Data which will be stored in the node.
         Key key_;
@@ -18,6 +22,17 @@ namespace heaps {
 
         ClassicalHeapNode(Key key, Derived *child_left, Derived *child_right);
 
+        // Adds delta to the key and, lazily, to all the keys below.
+        void AddToSubtree(const Key &delta);
+
+        // Restores the invariant of the node after its children are changed.
+        // Nodes without ranks have nothing to update, LeftistHeapNode hides it.
+        void UpdateRank() {}
+
+        // Applies the lazy delta to the children. Must be called before the children are changed.
+        // No-op for the keys without addition.
+        void PushDown();
+
         // Detaches the node from all the others.
         // Children of the detached vertex won't be destroyed after their parent is destroyed.
         void Detach();
@@ -57,16 +72,17 @@ namespace heaps {
     }
 
     template<class Key, class Derived>
-    ClassicalHeapNode<Key, Derived>::ClassicalHeapNode(const ClassicalHeapNode<Key, Derived> &other) : key_(other.key_),
+    ClassicalHeapNode<Key, Derived>::ClassicalHeapNode(const ClassicalHeapNode<Key, Derived> &other) : AdditiveTag<Key>(other),
+                                                                                                       key_(other.key_),
                                                                                                        child_left_(
                                                                                                                other.child_left_),
                                                                                                        child_right_(
                                                                                                                other.child_right_) {
         if (child_left_ != nullptr) {
-            child_left_ = new ClassicalHeapNode(*child_left_);
+            child_left_ = new Derived(*child_left_);
         }
         if (child_right_ != nullptr) {
-            child_right_ = new ClassicalHeapNode(*child_right_);
+            child_right_ = new Derived(*child_right_);
         }
     }
 
@@ -106,6 +122,26 @@ namespace heaps {
         std::swap(child_left_, x.child_left_);
         std::swap(child_right_, x.child_right_);
         std::swap(key_, x.key_);
+        std::swap(static_cast<AdditiveTag<Key> &>(*this), static_cast<AdditiveTag<Key> &>(x));
+    }
+
+    template<class Key, class Derived>
+    void ClassicalHeapNode<Key, Derived>::AddToSubtree(const Key &delta) {
+        key_ = key_ + delta;
+        this->delta_ = this->delta_ + delta;
+    }
+
+    template<class Key, class Derived>
+    void ClassicalHeapNode<Key, Derived>::PushDown() {
+        if constexpr (kAdditiveKey<Key>) {
+            if (child_left_ != nullptr) {
+                child_left_->AddToSubtree(this->delta_);
+            }
+            if (child_right_ != nullptr) {
+                child_right_->AddToSubtree(this->delta_);
+            }
+            this->delta_ = Key();
+        }
     }
 
     template<class Key, class Derived>
@@ -0,0 +1,123 @@
+#ifndef MERGEABLE_HEAPS_DOUBLE_ENDED_HEAP_NODE_H
+#define MERGEABLE_HEAPS_DOUBLE_ENDED_HEAP_NODE_H
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+namespace heaps {
+    // One node of the Double-Ended Heap.
+    // The node is shared by two leftist trees: the min-ordered one and the max-ordered one.
+    // Each tree has its own links, so a key is stored once and is removed from both trees in O(log n).
+    template<class Key>
+    class DoubleEndedHeapNode {
+    public:
+        // Index of the links of the min-ordered and the max-ordered trees
+        static constexpr size_t kMin = 0;
+        static constexpr size_t kMax = 1;
+
+        // Position of the node in one of the trees
+        struct Links {
+            DoubleEndedHeapNode *child_left_ = nullptr;
+            DoubleEndedHeapNode *child_right_ = nullptr;
+            DoubleEndedHeapNode *parent_ = nullptr;
+            // Length of the shortest path from node to the leaf.
+            uint32_t rank_ = 1;
+        };
+
+        Key key_;
+        std::array<Links, 2> links_;
+
+        explicit DoubleEndedHeapNode(Key key) : key_(std::move(key)) {}
+
+        // Merges 2 trees of the given side and returns the root of the result. Parent of the root is not set.
+        template<size_t Side>
+        static DoubleEndedHeapNode *Merge_(DoubleEndedHeapNode *root_1, DoubleEndedHeapNode *root_2);
+
+        // Removes the node from the tree of the given side and returns the new root. Node isn't deleted.
+        template<size_t Side>
+        static DoubleEndedHeapNode *Remove(DoubleEndedHeapNode *root, DoubleEndedHeapNode *v);
+
+    private:
+        // Checks if v1 must be above v2 in the tree of the given side.
+        template<size_t Side>
+        static bool Precedes(const DoubleEndedHeapNode *v1, const DoubleEndedHeapNode *v2);
+
+        template<size_t Side>
+        static uint32_t Rank(const DoubleEndedHeapNode *v);
+
+        // Restores the leftist property of the node and updates its rank. Returns true, if the rank has changed.
+        template<size_t Side>
+        static bool UpdateRank(DoubleEndedHeapNode *v);
+    };
+
+    template<class Key>
+    template<size_t Side>
+    bool DoubleEndedHeapNode<Key>::Precedes(const DoubleEndedHeapNode *v1, const DoubleEndedHeapNode *v2) {
+        if constexpr (Side == kMin) {
+            return v1->key_ < v2->key_;
+        } else {
+            return v2->key_ < v1->key_;
+        }
+    }
+
+    template<class Key>
+    template<size_t Side>
+    uint32_t DoubleEndedHeapNode<Key>::Rank(const DoubleEndedHeapNode *v) {
+        return v == nullptr ? 0 : v->links_[Side].rank_;
+    }
+
+    template<class Key>
+    template<size_t Side>
+    bool DoubleEndedHeapNode<Key>::UpdateRank(DoubleEndedHeapNode *v) {
+        Links &links = v->links_[Side];
+        if (Rank<Side>(links.child_left_) < Rank<Side>(links.child_right_)) {
+            std::swap(links.child_left_, links.child_right_);
+        }
+        const uint32_t rank = 1 + Rank<Side>(links.child_right_);
+        const bool changed = rank != links.rank_;
+        links.rank_ = rank;
+        return changed;
+    }
+
+    template<class Key>
+    template<size_t Side>
+    DoubleEndedHeapNode<Key> *DoubleEndedHeapNode<Key>::Merge_(DoubleEndedHeapNode *root_1,
+                                                               DoubleEndedHeapNode *root_2) {
+        if (root_1 == nullptr || root_2 == nullptr) {
+            return root_1 == nullptr ? root_2 : root_1;
+        }
+        if (Precedes<Side>(root_2, root_1)) {
+            std::swap(root_1, root_2);
+        }
+        Links &links = root_1->links_[Side];
+        links.child_right_ = Merge_<Side>(links.child_right_, root_2);
+        links.child_right_->links_[Side].parent_ = root_1;
+        UpdateRank<Side>(root_1);
+        return root_1;
+    }
+
+    template<class Key>
+    template<size_t Side>
+    DoubleEndedHeapNode<Key> *DoubleEndedHeapNode<Key>::Remove(DoubleEndedHeapNode *root, DoubleEndedHeapNode *v) {
+        Links &links = v->links_[Side];
+        DoubleEndedHeapNode *parent = links.parent_;
+        DoubleEndedHeapNode *replacement = Merge_<Side>(links.child_left_, links.child_right_);
+        if (replacement != nullptr) {
+            replacement->links_[Side].parent_ = parent;
+        }
+        links = Links();
+        if (parent == nullptr) {
+            return replacement;
+        }
+        Links &parent_links = parent->links_[Side];
+        (parent_links.child_left_ == v ? parent_links.child_left_ : parent_links.child_right_) = replacement;
+        // Ranks are fixed up the path, until one of them stays the same.
+        while (parent != nullptr && UpdateRank<Side>(parent)) {
+            parent = parent->links_[Side].parent_;
+        }
+        return root;
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_DOUBLE_ENDED_HEAP_NODE_H
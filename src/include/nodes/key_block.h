@@ -0,0 +1,283 @@
+#ifndef MERGEABLE_HEAPS_KEY_BLOCK_H
+#define MERGEABLE_HEAPS_KEY_BLOCK_H
+
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace heaps {
+    namespace detail {
+        // SIMD kernels are used for int and float keys, when the capacity is a multiple of the vector width.
+        template<class Key, size_t Capacity>
+        constexpr bool kSimdBlock =
+#if defined(__SSE2__)
+                (std::is_same_v<Key, int32_t> || std::is_same_v<Key, float>) && Capacity % 4 == 0 && Capacity <= 32;
+#else
+                false;
+#endif
+
+        // Value of unused slots of the arithmetic blocks, so the minimum may be found over the whole block.
+        template<class Key>
+        constexpr Key BlockSentinel() {
+            if constexpr (std::numeric_limits<Key>::has_infinity) {
+                return std::numeric_limits<Key>::infinity();
+            } else {
+                return std::numeric_limits<Key>::max();
+            }
+        }
+
+#if defined(__SSE2__)
+        // Lane-wise minimum of 32-bit integers. SSE2 lacks _mm_min_epi32, so it's emulated.
+        inline __m128i MinEpi32(__m128i a, __m128i b) {
+#if defined(__SSE4_1__)
+            return _mm_min_epi32(a, b);
+#else
+            __m128i greater = _mm_cmpgt_epi32(a, b);
+            return _mm_or_si128(_mm_and_si128(greater, b), _mm_andnot_si128(greater, a));
+#endif
+        }
+
+        // Minimal key of the block, all Capacity slots are compared.
+        template<size_t Capacity>
+        int32_t SimdMinimum(const int32_t *keys) {
+#if defined(__AVX2__)
+            if constexpr (Capacity % 8 == 0) {
+                __m256i m = _mm256_load_si256(reinterpret_cast<const __m256i *>(keys));
+                for (size_t i = 8; i < Capacity; i += 8) {
+                    m = _mm256_min_epi32(m, _mm256_load_si256(reinterpret_cast<const __m256i *>(keys + i)));
+                }
+                __m128i v = _mm_min_epi32(_mm256_castsi256_si128(m), _mm256_extracti128_si256(m, 1));
+                v = _mm_min_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+                v = _mm_min_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+                return _mm_cvtsi128_si32(v);
+            }
+#endif
+            __m128i v = _mm_load_si128(reinterpret_cast<const __m128i *>(keys));
+            for (size_t i = 4; i < Capacity; i += 4) {
+                v = MinEpi32(v, _mm_load_si128(reinterpret_cast<const __m128i *>(keys + i)));
+            }
+            v = MinEpi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+            v = MinEpi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+            return _mm_cvtsi128_si32(v);
+        }
+
+        template<size_t Capacity>
+        float SimdMinimum(const float *keys) {
+#if defined(__AVX2__)
+            if constexpr (Capacity % 8 == 0) {
+                __m256 m = _mm256_load_ps(keys);
+                for (size_t i = 8; i < Capacity; i += 8) {
+                    m = _mm256_min_ps(m, _mm256_load_ps(keys + i));
+                }
+                __m128 v = _mm_min_ps(_mm256_castps256_ps128(m), _mm256_extractf128_ps(m, 1));
+                v = _mm_min_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+                v = _mm_min_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+                return _mm_cvtss_f32(v);
+            }
+#endif
+            __m128 v = _mm_load_ps(keys);
+            for (size_t i = 4; i < Capacity; i += 4) {
+                v = _mm_min_ps(v, _mm_load_ps(keys + i));
+            }
+            v = _mm_min_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+            v = _mm_min_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+            return _mm_cvtss_f32(v);
+        }
+
+        // Bit i of the result is set, if keys[i] == value or keys[i] > value respectively.
+        template<size_t Capacity>
+        uint32_t SimdCompareMask(const int32_t *keys, int32_t value, bool greater) {
+            uint32_t mask = 0;
+            __m128i target = _mm_set1_epi32(value);
+            for (size_t i = 0; i < Capacity; i += 4) {
+                __m128i v = _mm_load_si128(reinterpret_cast<const __m128i *>(keys + i));
+                __m128i cmp = greater ? _mm_cmpgt_epi32(v, target) : _mm_cmpeq_epi32(v, target);
+                mask |= static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(cmp))) << i;
+            }
+            return mask;
+        }
+
+        template<size_t Capacity>
+        uint32_t SimdCompareMask(const float *keys, float value, bool greater) {
+            uint32_t mask = 0;
+            __m128 target = _mm_set1_ps(value);
+            for (size_t i = 0; i < Capacity; i += 4) {
+                __m128 v = _mm_load_ps(keys + i);
+                __m128 cmp = greater ? _mm_cmpgt_ps(v, target) : _mm_cmpeq_ps(v, target);
+                mask |= static_cast<uint32_t>(_mm_movemask_ps(cmp)) << i;
+            }
+            return mask;
+        }
+#endif
+    } // namespace detail
+
+    // Small unordered block of keys, stored contiguously.
+    // For int and float keys minimum search and comparisons are vectorized,
+    // unused slots are filled with a sentinel, so they never win the minimum.
+    template<class Key, size_t Capacity>
+    class KeyBlock {
+    public:
+        static_assert(Capacity > 0 && Capacity <= 32, "Block capacity must be in [1, 32]");
+
+        alignas(32) Key keys_[Capacity];
+        // Number of used slots, they come first
+        size_t size_;
+        // Minimal key of the used slots, valid if the block is not empty
+        Key minimum_;
+
+        KeyBlock();
+
+        explicit KeyBlock(Key key);
+
+        bool Full() const;
+
+        bool Empty() const;
+
+        // Appends the key, the block must not be full.
+        void Push(Key key);
+
+        // Returns the index of the minimal key. Block must not be empty.
+        size_t MinIndex() const;
+
+        // Returns the minimal key in O(1). Block must not be empty.
+        const Key &Min() const;
+
+        // Returns the mask of used slots, which keys are greater than the value.
+        uint32_t GreaterMask(const Key &value) const;
+
+        // Removes the key in the slot i, the last key takes its place.
+        void Erase(size_t i);
+
+        // Same as Erase, but doesn't update minimum_.
+        void EraseSlot(size_t i);
+
+        // Recomputes minimum_ after the keys are removed.
+        void UpdateMinimum();
+
+        // Moves all the keys greater than the value to the block "other".
+        // "other" must be empty.
+        void MoveGreater(const Key &value, KeyBlock &other);
+    };
+
+    template<class Key, size_t Capacity>
+    KeyBlock<Key, Capacity>::KeyBlock() : size_(0), minimum_() {
+        if constexpr (detail::kSimdBlock<Key, Capacity>) {
+            for (auto &key: keys_) {
+                key = detail::BlockSentinel<Key>();
+            }
+        }
+    }
+
+    template<class Key, size_t Capacity>
+    KeyBlock<Key, Capacity>::KeyBlock(Key key) : KeyBlock() {
+        Push(key);
+    }
+
+    template<class Key, size_t Capacity>
+    bool KeyBlock<Key, Capacity>::Full() const {
+        return size_ == Capacity;
+    }
+
+    template<class Key, size_t Capacity>
+    bool KeyBlock<Key, Capacity>::Empty() const {
+        return size_ == 0;
+    }
+
+    template<class Key, size_t Capacity>
+    void KeyBlock<Key, Capacity>::Push(Key key) {
+        if (size_ == 0 || key < minimum_) {
+            minimum_ = key;
+        }
+        keys_[size_++] = key;
+    }
+
+    template<class Key, size_t Capacity>
+    void KeyBlock<Key, Capacity>::UpdateMinimum() {
+        if (size_ == 0) {
+            return;
+        }
+#if defined(__SSE2__)
+        if constexpr (detail::kSimdBlock<Key, Capacity>) {
+            minimum_ = detail::SimdMinimum<Capacity>(keys_);
+            return;
+        }
+#endif
+        minimum_ = keys_[0];
+        for (size_t i = 1; i < size_; ++i) {
+            if (keys_[i] < minimum_) {
+                minimum_ = keys_[i];
+            }
+        }
+    }
+
+    template<class Key, size_t Capacity>
+    size_t KeyBlock<Key, Capacity>::MinIndex() const {
+#if defined(__SSE2__)
+        if constexpr (detail::kSimdBlock<Key, Capacity>) {
+            // Used slots come first, so the first match is a used one.
+            return static_cast<size_t>(__builtin_ctz(detail::SimdCompareMask<Capacity>(keys_, minimum_, false)));
+        }
+#endif
+        size_t minimal = 0;
+        for (size_t i = 1; i < size_; ++i) {
+            if (keys_[i] < keys_[minimal]) {
+                minimal = i;
+            }
+        }
+        return minimal;
+    }
+
+    template<class Key, size_t Capacity>
+    const Key &KeyBlock<Key, Capacity>::Min() const {
+        return minimum_;
+    }
+
+    template<class Key, size_t Capacity>
+    uint32_t KeyBlock<Key, Capacity>::GreaterMask(const Key &value) const {
+        const uint32_t used = size_ == 32 ? ~uint32_t(0) : (uint32_t(1) << size_) - 1;
+#if defined(__SSE2__)
+        if constexpr (detail::kSimdBlock<Key, Capacity>) {
+            return detail::SimdCompareMask<Capacity>(keys_, value, true) & used;
+        }
+#endif
+        uint32_t mask = 0;
+        for (size_t i = 0; i < size_; ++i) {
+            mask |= static_cast<uint32_t>(value < keys_[i]) << i;
+        }
+        return mask & used;
+    }
+
+    template<class Key, size_t Capacity>
+    void KeyBlock<Key, Capacity>::Erase(size_t i) {
+        EraseSlot(i);
+        UpdateMinimum();
+    }
+
+    template<class Key, size_t Capacity>
+    void KeyBlock<Key, Capacity>::EraseSlot(size_t i) {
+        keys_[i] = keys_[--size_];
+        if constexpr (detail::kSimdBlock<Key, Capacity>) {
+            keys_[size_] = detail::BlockSentinel<Key>();
+        }
+    }
+
+    template<class Key, size_t Capacity>
+    void KeyBlock<Key, Capacity>::MoveGreater(const Key &value, KeyBlock &other) {
+        uint32_t mask = GreaterMask(value);
+        // Going from the end, so the keys moved into the erased slots are already checked.
+        while (mask != 0) {
+            size_t i = 31 - static_cast<size_t>(__builtin_clz(mask));
+            mask &= ~(uint32_t(1) << i);
+            other.Push(keys_[i]);
+            EraseSlot(i);
+        }
+        // The minimum stays, unless all the keys are moved.
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_KEY_BLOCK_H
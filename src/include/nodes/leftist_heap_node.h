@@ -2,6 +2,7 @@
 #define MERGEABLE_HEAPS_LEFTIST_HEAP_NODE_H
 
 #include "classical_heap_node.h"
+#include "branchless_select.h"
 
 namespace heaps {
 
@@ -43,13 +44,23 @@ namespace heaps {
         if (root_1 == nullptr || root_2 == nullptr) {
             return root_1 == nullptr ? root_2 : root_1;
         }
-        if (!(root_1->key_ < root_2->key_)) {
+        if constexpr (kBranchlessKey<Key>) {
+            // Both candidates for the next step are fetched, while the comparison is pending.
+            __builtin_prefetch(root_1->child_right_);
+            __builtin_prefetch(root_2->child_right_);
+            detail::SwapIf(!(root_1->key_ < root_2->key_), root_1, root_2);
+        } else if (!(root_1->key_ < root_2->key_)) {
             std::swap(root_1, root_2);
         }
 
+        root_1->PushDown();
         root_1->child_right_ = Merge_(root_1->child_right_, root_2);
 
-        if (root_1->child_left_ == nullptr || root_1->child_left_->rank_ < root_1->child_right_->rank_) {
+        if constexpr (kBranchlessKey<Key>) {
+            // The right child is not empty after the merge.
+            const size_t left_rank = root_1->child_left_ == nullptr ? 0 : root_1->child_left_->rank_;
+            detail::SwapIf(left_rank < root_1->child_right_->rank_, root_1->child_left_, root_1->child_right_);
+        } else if (root_1->child_left_ == nullptr || root_1->child_left_->rank_ < root_1->child_right_->rank_) {
             std::swap(root_1->child_left_, root_1->child_right_);
         }
         root_1->UpdateRank();
@@ -0,0 +1,50 @@
+#ifndef MERGEABLE_HEAPS_RANDOMIZED_MELDABLE_HEAP_NODE_H
+#define MERGEABLE_HEAPS_RANDOMIZED_MELDABLE_HEAP_NODE_H
+
+#include "classical_heap_node.h"
+
+namespace heaps {
+    // One node of the randomized meldable heap, specifies ClassicalHeapNode.
+    // The node has no rank, the merge is balanced by random choices.
+    template<class Key>
+    class RandomizedMeldableHeapNode : public ClassicalHeapNode<Key, RandomizedMeldableHeapNode<Key>> {
+    public:
+        // Importing Base's constructors
+        using ClassicalHeapNode<Key, RandomizedMeldableHeapNode>::ClassicalHeapNode;
+
+        RandomizedMeldableHeapNode();
+
+        // Merges two subtrees and returns the result. "Steals" resources from root_1, root_2.
+        // The other root is merged into a random child of the smaller one, random_bit() chooses it.
+        // The path is O(log n) with high probability, it's walked once without recursion.
+        template<class RandomBit>
+        static RandomizedMeldableHeapNode *Merge_(RandomizedMeldableHeapNode *root_1,
+                                                  RandomizedMeldableHeapNode *root_2, RandomBit &&random_bit);
+    };
+
+    template<class Key>
+    template<class RandomBit>
+    RandomizedMeldableHeapNode<Key> *RandomizedMeldableHeapNode<Key>::Merge_(RandomizedMeldableHeapNode *root_1,
+                                                                             RandomizedMeldableHeapNode *root_2,
+                                                                             RandomBit &&random_bit) {
+        RandomizedMeldableHeapNode *root = nullptr;
+        // Place for the result of merging root_1 and root_2
+        RandomizedMeldableHeapNode **slot = &root;
+        while (root_1 != nullptr && root_2 != nullptr) {
+            if (!(root_1->key_ < root_2->key_)) {
+                std::swap(root_1, root_2);
+            }
+            root_1->PushDown();
+            *slot = root_1;
+            slot = random_bit() ? &root_1->child_left_ : &root_1->child_right_;
+            root_1 = *slot;
+        }
+        *slot = root_1 == nullptr ? root_2 : root_1;
+        return root;
+    }
+
+    template<class Key>
+    RandomizedMeldableHeapNode<Key>::RandomizedMeldableHeapNode() = default;
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_RANDOMIZED_MELDABLE_HEAP_NODE_H
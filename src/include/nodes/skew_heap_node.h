@@ -2,6 +2,7 @@
 #define MERGEABLE_HEAPS_SKEW_HEAP_NODE_H
 
 #include "classical_heap_node.h"
+#include "branchless_select.h"
 
 namespace heaps {
     // One node of the skew heap, specifies ClassicalHeapNode.
@@ -22,9 +23,15 @@ namespace heaps {
         if (root_1 == nullptr || root_2 == nullptr) {
             return root_1 == nullptr ? root_2 : root_1;
         }
-        if (!(root_1->key_ < root_2->key_)) {
+        if constexpr (kBranchlessKey<Key>) {
+            // Both candidates for the next step are fetched, while the comparison is pending.
+            __builtin_prefetch(root_1->child_right_);
+            __builtin_prefetch(root_2->child_right_);
+            detail::SwapIf(!(root_1->key_ < root_2->key_), root_1, root_2);
+        } else if (!(root_1->key_ < root_2->key_)) {
             std::swap(root_1, root_2);
         }
+        root_1->PushDown();
         SkewHeapNode *tmp_root = root_1->child_right_;
         std::swap(root_1->child_left_, root_1->child_right_);
         root_1->child_left_ = SkewHeapNode::Merge_(tmp_root, root_2);
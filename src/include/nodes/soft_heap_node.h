@@ -0,0 +1,165 @@
+#ifndef MERGEABLE_HEAPS_SOFT_HEAP_NODE_H
+#define MERGEABLE_HEAPS_SOFT_HEAP_NODE_H
+
+#include <list>
+#include <utility>
+#include <vector>
+
+namespace heaps {
+    // One node of the Soft Heap (Kaplan, Tarjan, Zwick, "Soft heaps simplified").
+    // The node stores a list of items, which all share the current key key_.
+    // Item is corrupted, if its own key is less than the current key of its node.
+    template<class Key>
+    class SoftHeapNode {
+    public:
+        // Items, which current key is key_
+        std::list<Key> items_;
+        // Current key of the items. Not greater than current keys of the children.
+        Key key_;
+        // Rank of the node. Leaves made by Insert have rank 0.
+        size_t rank_;
+        // Pointers to its children. Right child exists only if the left one does.
+        SoftHeapNode *child_left_;
+        SoftHeapNode *child_right_;
+
+        // Constructor of the leaf with one item
+        explicit SoftHeapNode(Key key);
+
+        // Returns true, if the node has no children.
+        bool IsLeaf() const;
+
+        // Links two roots of the same rank under the new node and fills it with items.
+        // Nodes with rank greater than "corruption_rank" may corrupt the items.
+        static SoftHeapNode *Link(SoftHeapNode *v1, SoftHeapNode *v2, size_t corruption_rank);
+
+        // Refills the items of the node from its children. Node must not be a leaf.
+        static void Defill(SoftHeapNode *v, size_t corruption_rank);
+
+        // Moves the items of the child with the smaller key into the node.
+        static void Fill(SoftHeapNode *v, size_t corruption_rank);
+
+        // Recursively collects items from the node and its children to the std::vector
+        void CollectData(std::vector<Key> &x) const;
+
+        // Recursively collects corrupted items from the node and its children to the std::vector
+        void CollectCorrupted(std::vector<Key> &x) const;
+
+        // Detaches the node from its children.
+        // Children of the detached vertex won't be destroyed after their parent is destroyed.
+        void Detach();
+
+        // Destructor. Destructs the node and it's subtree.
+        ~SoftHeapNode();
+
+        // Copy constructor. Creates the copy of the vertex and it's subtree.
+        SoftHeapNode(const SoftHeapNode &other);
+
+        SoftHeapNode &operator=(const SoftHeapNode &other) = delete;
+
+    private:
+        // Constructor of the inner node without items
+        SoftHeapNode(size_t rank, SoftHeapNode *child_left, SoftHeapNode *child_right);
+    };
+
+    template<class Key>
+    SoftHeapNode<Key>::SoftHeapNode(Key key) : items_(1, key), key_(std::move(key)), rank_(0),
+                                               child_left_(nullptr), child_right_(nullptr) {}
+
+    template<class Key>
+    SoftHeapNode<Key>::SoftHeapNode(size_t rank, SoftHeapNode *child_left, SoftHeapNode *child_right) :
+            key_(child_left->key_), rank_(rank), child_left_(child_left), child_right_(child_right) {}
+
+    template<class Key>
+    bool SoftHeapNode<Key>::IsLeaf() const {
+        return child_left_ == nullptr;
+    }
+
+    template<class Key>
+    SoftHeapNode<Key> *SoftHeapNode<Key>::Link(SoftHeapNode *v1, SoftHeapNode *v2, size_t corruption_rank) {
+        auto *v = new SoftHeapNode(v1->rank_ + 1, v1, v2);
+        Defill(v, corruption_rank);
+        return v;
+    }
+
+    template<class Key>
+    void SoftHeapNode<Key>::Defill(SoftHeapNode *v, size_t corruption_rank) {
+        Fill(v, corruption_rank);
+        // High odd ranks take the items of two children, this is where corruption comes from.
+        if (v->rank_ > corruption_rank && v->rank_ % 2 == 1 && !v->IsLeaf()) {
+            Fill(v, corruption_rank);
+        }
+    }
+
+    template<class Key>
+    void SoftHeapNode<Key>::Fill(SoftHeapNode *v, size_t corruption_rank) {
+        if (v->child_right_ != nullptr && v->child_right_->key_ < v->child_left_->key_) {
+            std::swap(v->child_left_, v->child_right_);
+        }
+        SoftHeapNode *child = v->child_left_;
+        v->key_ = child->key_;
+        v->items_.splice(v->items_.end(), child->items_);
+        if (child->IsLeaf()) {
+            v->child_left_ = v->child_right_;
+            v->child_right_ = nullptr;
+            delete child;
+        } else {
+            Defill(child, corruption_rank);
+        }
+    }
+
+    template<class Key>
+    void SoftHeapNode<Key>::CollectData(std::vector<Key> &x) const {
+        x.insert(x.end(), items_.begin(), items_.end());
+        if (child_left_ != nullptr) {
+            child_left_->CollectData(x);
+        }
+        if (child_right_ != nullptr) {
+            child_right_->CollectData(x);
+        }
+    }
+
+    template<class Key>
+    void SoftHeapNode<Key>::CollectCorrupted(std::vector<Key> &x) const {
+        for (const auto &item: items_) {
+            if (item < key_) {
+                x.push_back(item);
+            }
+        }
+        if (child_left_ != nullptr) {
+            child_left_->CollectCorrupted(x);
+        }
+        if (child_right_ != nullptr) {
+            child_right_->CollectCorrupted(x);
+        }
+    }
+
+    template<class Key>
+    void SoftHeapNode<Key>::Detach() {
+        child_left_ = child_right_ = nullptr;
+    }
+
+    template<class Key>
+    SoftHeapNode<Key>::~SoftHeapNode() {
+        if (child_left_ != nullptr) {
+            delete child_left_;
+        }
+        if (child_right_ != nullptr) {
+            delete child_right_;
+        }
+    }
+
+    template<class Key>
+    SoftHeapNode<Key>::SoftHeapNode(const SoftHeapNode &other) : items_(other.items_), key_(other.key_),
+                                                                 rank_(other.rank_),
+                                                                 child_left_(other.child_left_),
+                                                                 child_right_(other.child_right_) {
+        if (child_left_ != nullptr) {
+            child_left_ = new SoftHeapNode(*child_left_);
+        }
+        if (child_right_ != nullptr) {
+            child_right_ = new SoftHeapNode(*child_right_);
+        }
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_SOFT_HEAP_NODE_H
@@ -0,0 +1,74 @@
+#ifndef MERGEABLE_HEAPS_WEIGHT_BIASED_LEFTIST_HEAP_NODE_H
+#define MERGEABLE_HEAPS_WEIGHT_BIASED_LEFTIST_HEAP_NODE_H
+
+#include "classical_heap_node.h"
+
+namespace heaps {
+
+    // One node of the Weight-Biased Leftist Heap
+    // Specifies the ClassicalHeapNode class
+    template<class Key>
+    class WeightBiasedLeftistHeapNode : public ClassicalHeapNode<Key, WeightBiasedLeftistHeapNode<Key>> {
+    public:
+        // Weight is the number of nodes in the subtree. Left child is never lighter than the right one.
+        size_t weight_;
+        using Base = ClassicalHeapNode<Key, WeightBiasedLeftistHeapNode<Key>>;
+
+        // Primitive constructor
+        WeightBiasedLeftistHeapNode();
+
+        // Weight of the subtree, 0 for nullptr.
+        static size_t Weight(const WeightBiasedLeftistHeapNode *v);
+
+        // Method updates weight_ value using the children value.
+        void UpdateRank();
+
+        // Merges 2 subtrees and returns the result. Steals resources from root_1, root_2
+        // The weights of the merged subtrees are known on the way down, so the children are swapped
+        // in the same pass, without recursion.
+        static WeightBiasedLeftistHeapNode *Merge_(WeightBiasedLeftistHeapNode *root_1,
+                                                   WeightBiasedLeftistHeapNode *root_2);
+    };
+
+    template<class Key>
+    WeightBiasedLeftistHeapNode<Key>::WeightBiasedLeftistHeapNode() : Base(), weight_(1) {}
+
+    template<class Key>
+    size_t WeightBiasedLeftistHeapNode<Key>::Weight(const WeightBiasedLeftistHeapNode *v) {
+        return v == nullptr ? 0 : v->weight_;
+    }
+
+    template<class Key>
+    void WeightBiasedLeftistHeapNode<Key>::UpdateRank() {
+        weight_ = 1 + Weight(Base::child_left_) + Weight(Base::child_right_);
+    }
+
+    template<class Key>
+    WeightBiasedLeftistHeapNode<Key> *WeightBiasedLeftistHeapNode<Key>::Merge_(WeightBiasedLeftistHeapNode *root_1,
+                                                                               WeightBiasedLeftistHeapNode *root_2) {
+        WeightBiasedLeftistHeapNode *root = nullptr;
+        // Place for the result of merging root_1 and root_2
+        WeightBiasedLeftistHeapNode **slot = &root;
+        while (root_1 != nullptr && root_2 != nullptr) {
+            if (!(root_1->key_ < root_2->key_)) {
+                std::swap(root_1, root_2);
+            }
+            root_1->PushDown();
+            *slot = root_1;
+            root_1->weight_ += root_2->weight_;
+            WeightBiasedLeftistHeapNode *right = root_1->child_right_;
+            // The right subtree merged with root_2 goes to the left, if it's heavier than the left one.
+            if (Weight(root_1->child_left_) < Weight(right) + root_2->weight_) {
+                root_1->child_right_ = root_1->child_left_;
+                slot = &root_1->child_left_;
+            } else {
+                slot = &root_1->child_right_;
+            }
+            root_1 = right;
+        }
+        *slot = root_1 == nullptr ? root_2 : root_1;
+        return root;
+    }
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_WEIGHT_BIASED_LEFTIST_HEAP_NODE_H
@@ -0,0 +1,155 @@
+#ifndef MERGEABLE_HEAPS_PARALLEL_DRAIN_H
+#define MERGEABLE_HEAPS_PARALLEL_DRAIN_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace heaps {
+    namespace detail {
+        // Runs task(i) for every i < tasks_cnt on at most threads_cnt threads, the calling one included.
+        // The tasks are taken in the order of i, so the long ones should go first.
+        template<class Task>
+        void ParallelFor(size_t tasks_cnt, size_t threads_cnt, Task &&task) {
+            std::atomic<size_t> next{0};
+            auto work = [&] {
+                for (size_t i = next++; i < tasks_cnt; i = next++) {
+                    task(i);
+                }
+            };
+            std::vector<std::thread> threads;
+            for (size_t i = 1; i < std::min(threads_cnt, tasks_cnt); ++i) {
+                threads.emplace_back(work);
+            }
+            work();
+            for (auto &thread: threads) {
+                thread.join();
+            }
+        }
+
+        // Moves the keys of runs[r][begin[r], end[r]) to out in the sorted order. Heap of the run heads, O(n log k)
+        // Returns the end of the output.
+        template<class Key, class OutputIt>
+        OutputIt MergeSlice(std::vector<std::vector<Key>> &runs, const std::vector<size_t> &begin,
+                            const std::vector<size_t> &end, OutputIt out) {
+            std::vector<size_t> position(begin);
+            // Runs with the keys left, the smallest head on top
+            std::vector<size_t> heads;
+            auto greater = [&](size_t a, size_t b) {
+                return runs[b][position[b]] < runs[a][position[a]];
+            };
+            for (size_t r = 0; r < runs.size(); ++r) {
+                if (position[r] < end[r]) {
+                    heads.push_back(r);
+                }
+            }
+            std::make_heap(heads.begin(), heads.end(), greater);
+            while (heads.size() > 1) {
+                std::pop_heap(heads.begin(), heads.end(), greater);
+                const size_t r = heads.back();
+                *out++ = std::move(runs[r][position[r]++]);
+                if (position[r] < end[r]) {
+                    std::push_heap(heads.begin(), heads.end(), greater);
+                } else {
+                    heads.pop_back();
+                }
+            }
+            if (!heads.empty()) {
+                const size_t r = heads.back();
+                out = std::move(runs[r].begin() + static_cast<std::ptrdiff_t>(position[r]),
+                                runs[r].begin() + static_cast<std::ptrdiff_t>(end[r]), out);
+            }
+            return out;
+        }
+
+        // Cuts the keys of the sorted runs into slices_cnt slices of about the same size by the splitters,
+        // which are taken from a sample of every run. bounds[s][r] is the first key of the run r in the slice s.
+        // The runs must not be empty.
+        template<class Key>
+        std::vector<std::vector<size_t>> SliceRuns(const std::vector<std::vector<Key>> &runs, size_t slices_cnt) {
+            constexpr size_t kSamplesPerRun = 64;
+            std::vector<Key> sample;
+            for (const auto &run: runs) {
+                for (size_t i = 0; i < kSamplesPerRun; ++i) {
+                    sample.push_back(run[i * run.size() / kSamplesPerRun]);
+                }
+            }
+            std::sort(sample.begin(), sample.end());
+            std::vector<std::vector<size_t>> bounds(slices_cnt + 1, std::vector<size_t>(runs.size(), 0));
+            for (size_t r = 0; r < runs.size(); ++r) {
+                for (size_t s = 1; s < slices_cnt; ++s) {
+                    const Key &splitter = sample[s * sample.size() / slices_cnt];
+                    bounds[s][r] = static_cast<size_t>(
+                            std::lower_bound(runs[r].begin(), runs[r].end(), splitter) - runs[r].begin());
+                }
+                bounds[slices_cnt][r] = runs[r].size();
+            }
+            return bounds;
+        }
+
+        // Merges the sorted runs into out and frees them. The output is cut into slices, which are merged in parallel.
+        // Random access outputs are written by the threads directly. For the others the slices are merged
+        // in rounds of threads_cnt into own buffers, which are written in order and freed before the next round,
+        // so a few slices are held at once, not a copy of the output.
+        template<class Key, class OutputIt>
+        OutputIt MergeRuns(std::vector<std::vector<Key>> &runs, OutputIt out, size_t threads_cnt) {
+            using Category = typename std::iterator_traits<OutputIt>::iterator_category;
+            constexpr bool kRandomAccess = std::is_base_of_v<std::random_access_iterator_tag, Category>;
+            runs.erase(std::remove_if(runs.begin(), runs.end(), [](const std::vector<Key> &run) {
+                return run.empty();
+            }), runs.end());
+            size_t total = 0;
+            for (const auto &run: runs) {
+                total += run.size();
+            }
+            // Small slices aren't worth a thread.
+            constexpr size_t kMinSlice = 1 << 14;
+            // Rounds of the buffered merge, the buffers hold about 1 / kStreamRounds of the keys.
+            constexpr size_t kStreamRounds = 4;
+            const size_t slices_wanted = kRandomAccess || threads_cnt == 1 ? threads_cnt : kStreamRounds * threads_cnt;
+            const size_t slices_cnt = std::max<size_t>(1, std::min(slices_wanted, total / kMinSlice));
+            const auto bounds = SliceRuns(runs, slices_cnt);
+            if (slices_cnt == 1) {
+                out = MergeSlice(runs, bounds[0], bounds[1], out);
+                runs.clear();
+                return out;
+            }
+            std::vector<size_t> offset(slices_cnt + 1, 0);
+            for (size_t s = 0; s < slices_cnt; ++s) {
+                offset[s + 1] = offset[s];
+                for (size_t r = 0; r < runs.size(); ++r) {
+                    offset[s + 1] += bounds[s + 1][r] - bounds[s][r];
+                }
+            }
+            if constexpr (kRandomAccess) {
+                ParallelFor(slices_cnt, threads_cnt, [&](size_t s) {
+                    MergeSlice(runs, bounds[s], bounds[s + 1], out + static_cast<std::ptrdiff_t>(offset[s]));
+                });
+                out += static_cast<std::ptrdiff_t>(total);
+            } else {
+                for (size_t first = 0; first < slices_cnt; first += threads_cnt) {
+                    const size_t round_cnt = std::min(threads_cnt, slices_cnt - first);
+                    std::vector<std::vector<Key>> buffers(round_cnt);
+                    ParallelFor(round_cnt, threads_cnt, [&](size_t i) {
+                        const size_t s = first + i;
+                        buffers[i].resize(offset[s + 1] - offset[s]);
+                        MergeSlice(runs, bounds[s], bounds[s + 1], buffers[i].begin());
+                    });
+                    for (auto &buffer: buffers) {
+                        out = std::move(buffer.begin(), buffer.end(), out);
+                        std::vector<Key>().swap(buffer);
+                    }
+                }
+            }
+            runs.clear();
+            return out;
+        }
+    } // namespace detail
+} // namespace heaps
+
+#endif // MERGEABLE_HEAPS_PARALLEL_DRAIN_H
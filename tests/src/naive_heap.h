@@ -1,6 +1,8 @@
 #ifndef MERGEABLE_HEAPS_NAIVE_HEAP_H
 #define MERGEABLE_HEAPS_NAIVE_HEAP_H
 
+#include <set>
+#include <vector>
 #include "heap_interface.h"
 #include "mergeable_heaps/exceptions.h"
 
@@ -15,6 +17,8 @@ namespace heaps {
         void Merge_(StlHeap<Key> &x);
 
     public:
+        StlHeap() = default;
+
         explicit StlHeap(Key key);
 
         void Insert(Key x) override;
@@ -1,9 +1,38 @@
 #include <gtest/gtest.h>
+#include <map>
+#include <csignal>
+#include <sys/wait.h>
 #include "test_case.h"
 #include "test_action.h"
 #include "mergeable_heaps/binomial_heap.h"
 #include "mergeable_heaps/leftist_heap.h"
 #include "mergeable_heaps/skew_heap.h"
+#include "mergeable_heaps/weight_biased_leftist_heap.h"
+#include "mergeable_heaps/deamortized_skew_heap.h"
+#include "mergeable_heaps/randomized_meldable_heap.h"
+#include "mergeable_heaps/root_table_binomial_heap.h"
+#include "mergeable_heaps/lazy_binomial_heap.h"
+#include "mergeable_heaps/skew_binomial_heap.h"
+#include "mergeable_heaps/blocked_leftist_heap.h"
+#include "mergeable_heaps/blocked_skew_heap.h"
+#include "mergeable_heaps/radix_heap.h"
+#include "mergeable_heaps/soft_heap.h"
+#include "mergeable_heaps/soft_select.h"
+#include "mergeable_heaps/algorithms/dijkstra.h"
+#include "mergeable_heaps/algorithms/prim.h"
+#include "mergeable_heaps/algorithms/huffman.h"
+#include "mergeable_heaps/algorithms/kway_merge.h"
+#include "mergeable_heaps/algorithms/arborescence.h"
+#include "mergeable_heaps/work_stealing_scheduler.h"
+#include "mergeable_heaps/timer_queue.h"
+#include "mergeable_heaps/double_ended_heap.h"
+#include "mergeable_heaps/tombstone_heap.h"
+#include "mergeable_heaps/conversion.h"
+#include "mergeable_heaps/payload_heap.h"
+#include "mergeable_heaps/bounded_heap.h"
+#include "mergeable_heaps/normalized_key.h"
+#include "mergeable_heaps/priority_channel.h"
+#include "mergeable_heaps/shared_memory_heap.h"
 #include "naive_heap.h"
 #include "simple_key.h"
 
@@ -18,20 +47,1609 @@ void TestHeap(const std::vector<TestAction> &actions) {
     }
 }
 
-// Declaring 4 tests for every type of the heap.
+// Inserts random keys into two heaps, merges them and checks,
+// that the keys are extracted in the sorted order.
+template<typename T, typename Key>
+void TestSortedExtraction(size_t keys_cnt) {
+    std::mt19937 gen(keys_cnt);
+    std::vector<Key> keys(keys_cnt);
+    T first, second;
+    for (size_t i = 0; i < keys_cnt; ++i) {
+        keys[i] = static_cast<Key>(gen() % 1000);
+        (i % 3 == 0 ? first : second).Insert(keys[i]);
+    }
+    first.Merge(second);
+    std::sort(keys.begin(), keys.end());
+    ASSERT_EQ(first.Size(), keys_cnt);
+    for (const auto &key: keys) {
+        ASSERT_EQ(first.GetMinimum(), key);
+        first.ExtractMinimum();
+    }
+    EXPECT_TRUE(first.Empty());
+}
+
+// Soft heap with the error rate so small, that no item is ever corrupted.
+class ExactSoftHeap : public heaps::SoftHeap<SimpleKey> {
+public:
+    explicit ExactSoftHeap(SimpleKey key) : SoftHeap(key, 1e-30) {}
+};
+
+// Declaring tests for every type of the heap.
 
 TEST_F(TestCase, BinomialHeapTest) {
     TestHeap<heaps::BinomialHeap<SimpleKey>>(actions_);
 }
 
+TEST_F(TestCase, RootTableBinomialHeapTest) {
+    TestHeap<heaps::RootTableBinomialHeap<SimpleKey>>(actions_);
+}
+
+TEST_F(TestCase, LazyBinomialHeapTest) {
+    TestHeap<heaps::LazyBinomialHeap<SimpleKey>>(actions_);
+}
+
+TEST_F(TestCase, SkewBinomialHeapTest) {
+    TestHeap<heaps::SkewBinomialHeap<SimpleKey>>(actions_);
+}
+
+// Every smaller key replaces the global root, the old one goes to the trees.
+TEST(SkewBinomialHeap, GlobalRoot) {
+    heaps::SkewBinomialHeap<int> heap, empty;
+    for (int key = 1000; key > 0; --key) {
+        heap.Insert(key);
+        ASSERT_EQ(heap.GetMinimum(), key);
+    }
+    heap.Merge(empty);
+    empty.Merge(heap);
+    EXPECT_TRUE(heap.Empty());
+    heaps::SkewBinomialHeap<int> copy(empty);
+    copy.ExtractMinimum();
+    EXPECT_EQ(copy.GetMinimum(), 2);
+    EXPECT_EQ(empty.Size(), 1000u);
+    for (int key = 1; key <= 1000; ++key) {
+        ASSERT_EQ(empty.GetMinimum(), key);
+        empty.ExtractMinimum();
+    }
+    EXPECT_THROW(empty.GetMinimum(), heaps::EmptyHeapException);
+    TestSortedExtraction<heaps::SkewBinomialHeap<int>, int>(10'000);
+}
+
 TEST_F(TestCase, LeftistHeapTest) {
     TestHeap<heaps::LeftistHeap<SimpleKey>>(actions_);
 }
 
+TEST_F(TestCase, WeightBiasedLeftistHeapTest) {
+    TestHeap<heaps::WeightBiasedLeftistHeap<SimpleKey>>(actions_);
+}
+
 TEST_F(TestCase, SkewHeapTest) {
     TestHeap<heaps::SkewHeap<SimpleKey>>(actions_);
 }
 
+TEST_F(TestCase, DeamortizedSkewHeapTest) {
+    TestHeap<heaps::DeamortizedSkewHeap<SimpleKey>>(actions_);
+}
+
+TEST_F(TestCase, OneStepSkewHeapTest) {
+    TestHeap<heaps::DeamortizedSkewHeap<SimpleKey, 1>>(actions_);
+}
+
+TEST_F(TestCase, RandomizedMeldableHeapTest) {
+    TestHeap<heaps::RandomizedMeldableHeap<SimpleKey>>(actions_);
+}
+
+TEST_F(TestCase, BlockedLeftistHeapTest) {
+    TestHeap<heaps::BlockedLeftistHeap<SimpleKey>>(actions_);
+}
+
+TEST_F(TestCase, BlockedSkewHeapTest) {
+    TestHeap<heaps::BlockedSkewHeap<SimpleKey, 4>>(actions_);
+}
+
+TEST_F(TestCase, InlineLeftistHeapTest) {
+    TestHeap<heaps::LeftistHeap<SimpleKey, 8>>(actions_);
+}
+
+TEST_F(TestCase, InlineBinomialHeapTest) {
+    TestHeap<heaps::BinomialHeap<SimpleKey, 16>>(actions_);
+}
+
+TEST_F(TestCase, BufferedLeftistHeapTest) {
+    TestHeap<heaps::LeftistHeap<SimpleKey, 0, true>>(actions_);
+}
+
+TEST_F(TestCase, BufferedBinomialHeapTest) {
+    TestHeap<heaps::BinomialHeap<SimpleKey, 4, true>>(actions_);
+}
+
+// Inserted keys wait in the buffer until the next extraction or merge, the minimum is known meanwhile.
+template<typename T>
+void TestInsertBuffer() {
+    T heap, other;
+    heap.Insert(50);
+    heap.ExtractMinimum();
+    for (int i = 0; i < 1000; ++i) {
+        heap.Insert((i * 7919) % 1000);
+        other.Insert(1000 + i);
+        ASSERT_EQ(heap.GetMinimum(), 0);
+    }
+    EXPECT_EQ(heap.BufferedSize(), 1000u);
+    EXPECT_EQ(heap.Size(), 1000u);
+    heap.ExtractMinimum();
+    EXPECT_EQ(heap.BufferedSize(), 0u);
+    heap.Insert(-1);
+    EXPECT_EQ(heap.GetMinimum(), -1);
+    heap.Insert(5);
+    EXPECT_EQ(heap.GetMinimum(), -1);
+    heap.Merge(other);
+    EXPECT_EQ(heap.BufferedSize(), 0u);
+    EXPECT_EQ(other.BufferedSize(), 0u);
+    EXPECT_EQ(heap.Size(), 2001u);
+    T copy(heap);
+    copy.Insert(3);
+    EXPECT_EQ(copy.Data().size(), 2002u);
+    std::vector<int> expected{-1, 5};
+    for (int i = 1; i < 2000; ++i) {
+        expected.push_back(i);
+    }
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(heap.Data(), expected);
+    TestSortedExtraction<T, int>(10'000);
+}
+
+TEST(InsertBuffer, DeferredMelding) {
+    TestInsertBuffer<heaps::LeftistHeap<int, 0, true>>();
+    TestInsertBuffer<heaps::SkewHeap<int, 0, true>>();
+    TestInsertBuffer<heaps::LeftistHeap<int, 8, true>>();
+    TestInsertBuffer<heaps::BinomialHeap<int, 0, true>>();
+    TestInsertBuffer<heaps::BinomialHeap<int, 16, true>>();
+}
+
+// Small heaps keep the keys inline, until they outgrow the buffer or meet a tree heap.
+TEST(InlineHeap, Promotion) {
+    heaps::SkewHeap<int, 4> small(5), other, large;
+    small.Insert(3);
+    other.Insert(4);
+    other.Insert(1);
+    small.Merge(other);
+    EXPECT_TRUE(small.IsInline());
+    EXPECT_EQ(small.Size(), 4u);
+    EXPECT_EQ(small.GetMinimum(), 1);
+
+    for (int i = 0; i < 10; ++i) {
+        large.Insert(10 - i);
+    }
+    EXPECT_FALSE(large.IsInline());
+    heaps::SkewHeap<int, 4> copy(small);
+    copy.Merge(large);
+    EXPECT_FALSE(copy.IsInline());
+    EXPECT_EQ(copy.Size(), 14u);
+    EXPECT_EQ(small.Data(), (std::vector<int>{1, 3, 4, 5}));
+    for (int expected: {1, 1, 2, 3, 3, 4, 4, 5, 5, 6, 7, 8, 9, 10}) {
+        ASSERT_EQ(copy.GetMinimum(), expected);
+        copy.ExtractMinimum();
+    }
+    EXPECT_TRUE(copy.IsInline());
+    EXPECT_THROW(copy.ExtractMinimum(), heaps::EmptyHeapException);
+
+    heaps::BinomialHeap<int, 2> binomial(2);
+    binomial.Insert(1);
+    EXPECT_TRUE(binomial.IsInline());
+    binomial.Insert(0);
+    EXPECT_FALSE(binomial.IsInline());
+    EXPECT_EQ(binomial.Data(), (std::vector<int>{0, 1, 2}));
+    TestSortedExtraction<heaps::LeftistHeap<int, 16>, int>(10'000);
+    TestSortedExtraction<heaps::BinomialHeap<int, 16>, int>(10'000);
+}
+
+// Shifts keys of random heaps by random deltas and melds them, compared against multisets.
+// Keys of correct[h] are stored without the offset[h].
+template<typename T>
+void TestAddToAll() {
+    std::mt19937 gen(32);
+    std::vector<T> heaps(16);
+    std::vector<std::multiset<int64_t>> correct(16);
+    std::vector<int64_t> offset(16);
+    for (int i = 0; i < 20'000; ++i) {
+        size_t h = gen() % heaps.size();
+        switch (gen() % 4) {
+            case 0: {
+                auto key = static_cast<int64_t>(gen() % 1000);
+                heaps[h].Insert(key);
+                correct[h].insert(key - offset[h]);
+                break;
+            }
+            case 1: {
+                auto delta = static_cast<int64_t>(gen() % 2001) - 1000;
+                heaps[h].AddToAll(delta);
+                offset[h] += delta;
+                break;
+            }
+            case 2: {
+                if (!correct[h].empty()) {
+                    ASSERT_EQ(heaps[h].GetMinimum(), *correct[h].begin() + offset[h]);
+                    heaps[h].ExtractMinimum();
+                    correct[h].erase(correct[h].begin());
+                }
+                break;
+            }
+            case 3: {
+                size_t other = gen() % heaps.size();
+                if (other != h) {
+                    heaps[h].Merge(heaps[other]);
+                    for (auto key: correct[other]) {
+                        correct[h].insert(key + offset[other] - offset[h]);
+                    }
+                    correct[other].clear();
+                }
+                break;
+            }
+        }
+        ASSERT_EQ(heaps[h].Size(), correct[h].size());
+    }
+    for (size_t h = 0; h < heaps.size(); ++h) {
+        std::vector<int64_t> keys;
+        for (auto key: correct[h]) {
+            keys.push_back(key + offset[h]);
+        }
+        EXPECT_EQ(heaps[h].Data(), keys);
+    }
+}
+
+TEST(AdditiveTags, AddToAll) {
+    TestAddToAll<heaps::LeftistHeap<int64_t>>();
+    TestAddToAll<heaps::SkewHeap<int64_t>>();
+    TestAddToAll<heaps::LeftistHeap<int64_t, 8>>();
+    TestAddToAll<heaps::SkewHeap<int64_t, 0, true>>();
+    TestAddToAll<heaps::WeightBiasedLeftistHeap<int64_t>>();
+    TestAddToAll<heaps::RandomizedMeldableHeap<int64_t>>();
+    // Keys without addition don't pay for the tags.
+    static_assert(std::is_empty_v<heaps::AdditiveTag<SimpleKey>>);
+    static_assert(std::is_empty_v<heaps::AdditiveTag<std::string>>);
+    struct UntaggedNode {
+        SimpleKey key_;
+        void *child_left_, *child_right_;
+    };
+    static_assert(sizeof(heaps::SkewHeapNode<SimpleKey>) == sizeof(UntaggedNode));
+}
+
+// Key opted in for the branchless merges
+struct CmovKey {
+    int value_;
+
+    CmovKey(int value = 0) : value_(value) {}
+
+    bool operator<(const CmovKey &other) const {
+        return value_ < other.value_;
+    }
+
+    bool operator==(const CmovKey &other) const {
+        return value_ == other.value_;
+    }
+
+    CmovKey operator+(const CmovKey &other) const {
+        return CmovKey(value_ + other.value_);
+    }
+};
+
+template<>
+struct heaps::BranchlessKey<CmovKey> : std::true_type {};
+
+TEST(BranchlessMerge, OptedInKeys) {
+    static_assert(!heaps::kBranchlessKey<int>);
+    int first = 1, second = 2;
+    int *a = &first, *b = &second;
+    heaps::detail::SwapIf(false, a, b);
+    EXPECT_EQ(*a, 1);
+    heaps::detail::SwapIf(true, a, b);
+    EXPECT_EQ(*a, 2);
+    EXPECT_EQ(*b, 1);
+    TestSortedExtraction<heaps::LeftistHeap<CmovKey>, CmovKey>(10'000);
+    TestSortedExtraction<heaps::SkewHeap<CmovKey>, CmovKey>(10'000);
+    heaps::LeftistHeap<CmovKey> heap;
+    std::vector<int> expected;
+    for (int i = 0; i < 100; ++i) {
+        heap.Insert(i * 37 % 100);
+        heap.AddToAll(CmovKey(1));
+        expected.push_back(i * 37 % 100 + 100 - i);
+    }
+    std::sort(expected.begin(), expected.end());
+    for (int key: expected) {
+        ASSERT_EQ(heap.GetMinimum(), CmovKey(key));
+        heap.ExtractMinimum();
+    }
+}
+
+// Merges in progress are continued by the later operations, copied and flushed.
+TEST(DeamortizedSkewHeap, IncrementalMerge) {
+    TestSortedExtraction<heaps::DeamortizedSkewHeap<int, 1>, int>(10'000);
+    TestSortedExtraction<heaps::DeamortizedSkewHeap<int, 4>, int>(10'000);
+    heaps::DeamortizedSkewHeap<int, 2> heap, other;
+    for (int i = 0; i < 1000; ++i) {
+        heap.Insert(i);
+        other.Insert(1000 - i);
+    }
+    heap.Merge(other);
+    heaps::DeamortizedSkewHeap<int, 2> copy(heap);
+    EXPECT_EQ(copy.Data(), heap.Data());
+    // The merge of the two trees outlives the next operations, each of them advances it by 1 or 2 steps.
+    ASSERT_GT(heap.MergesInProgress(), 0u);
+    size_t inserts = 0;
+    while (heap.MergesInProgress() > 0) {
+        const size_t steps = heap.StepsCount();
+        heap.Insert(2000);
+        copy.Insert(2000);
+        ++inserts;
+        ASSERT_GE(heap.StepsCount() - steps, 1u);
+        ASSERT_LE(heap.StepsCount() - steps, 2u);
+    }
+    EXPECT_GE(inserts, 2u);
+    heap.Flush();
+    EXPECT_EQ(heap.PiecesCount(), 1u);
+    // Keys 1..999 are in both heaps.
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_EQ(heap.GetMinimum(), (i + 1) / 2);
+        ASSERT_EQ(copy.GetMinimum(), (i + 1) / 2);
+        heap.ExtractMinimum();
+        copy.ExtractMinimum();
+    }
+    EXPECT_EQ(copy.Size(), 1990u + inserts);
+    EXPECT_EQ(copy.Data(), heap.Data());
+}
+
+// Arithmetic keys use the vectorized blocks.
+TEST(BlockedHeap, ArithmeticKeys) {
+    TestSortedExtraction<heaps::BlockedLeftistHeap<int, 8>, int>(10'000);
+    TestSortedExtraction<heaps::BlockedLeftistHeap<float, 16>, float>(10'000);
+    TestSortedExtraction<heaps::BlockedSkewHeap<uint64_t, 8>, uint64_t>(10'000);
+    TestSortedExtraction<heaps::BlockedSkewHeap<int, 32>, int>(10'000);
+}
+
+// Priorities never go below the last extracted one, as in Dijkstra's algorithm.
+TEST(RadixHeap, MonotonePriorities) {
+    using Heap = heaps::RadixHeap<uint32_t, int>;
+    std::mt19937 gen(29);
+    Heap heap, other;
+    std::multiset<std::pair<uint32_t, int>> correct;
+    uint32_t last = 0;
+    for (int i = 0; i < 100'000; ++i) {
+        switch (gen() % 4) {
+            case 0:
+            case 1: {
+                std::pair<uint32_t, int> item(last + gen() % 1000, i);
+                heap.Insert(item);
+                correct.insert(item);
+                break;
+            }
+            case 2: {
+                if (correct.empty()) {
+                    EXPECT_THROW(heap.ExtractMinimum(), heaps::EmptyHeapException);
+                    break;
+                }
+                // Items of the same priority may go in any order, but the reported one must be extracted.
+                const auto minimum = heap.GetMinimum();
+                ASSERT_EQ(minimum.first, correct.begin()->first);
+                auto it = correct.find(minimum);
+                ASSERT_NE(it, correct.end());
+                last = minimum.first;
+                heap.ExtractMinimum();
+                correct.erase(it);
+                break;
+            }
+            case 3: {
+                std::pair<uint32_t, int> item(last + gen() % 100'000, i);
+                other.Insert(item);
+                correct.insert(item);
+                heap.Merge(other);
+                EXPECT_TRUE(other.Empty());
+                break;
+            }
+        }
+        ASSERT_EQ(heap.Size(), correct.size());
+    }
+    EXPECT_EQ(heap.Data(), (std::vector<std::pair<uint32_t, int>>(correct.begin(), correct.end())));
+
+    Heap ties;
+    for (auto item: {std::make_pair(5u, 1), std::make_pair(5u, 2), std::make_pair(7u, 3)}) {
+        ties.Insert(item);
+    }
+    std::multiset<int> payloads;
+    while (!ties.Empty()) {
+        payloads.insert(ties.GetMinimum().second);
+        ties.ExtractMinimum();
+    }
+    EXPECT_EQ(payloads, (std::multiset<int>{1, 2, 3}));
+}
+
+TEST_F(TestCase, SoftHeapTest) {
+    TestHeap<ExactSoftHeap>(actions_);
+}
+
+// Number of corrupted items never exceeds epsilon * n, extracted items are the ones with minimal current keys.
+TEST(SoftHeap, CorruptionBound) {
+    std::mt19937 gen(30);
+    for (double epsilon: {0.5, 1.0 / 8, 1.0 / 64}) {
+        heaps::SoftHeap<int> heap(epsilon), other(epsilon);
+        size_t inserted = 0;
+        for (int i = 0; i < 100'000; ++i) {
+            (i % 5 == 0 ? other : heap).Insert(static_cast<int>(gen() % 1'000'000));
+            ++inserted;
+            if (i % 1000 == 999) {
+                heap.Merge(other);
+            }
+            if (i % 3 == 0 && !heap.Empty()) {
+                int current = heap.GetMinimumCurrentKey();
+                ASSERT_TRUE(heap.GetMinimum() <= current);
+                ASSERT_EQ(heap.IsMinimumCorrupted(), heap.GetMinimum() < current);
+                heap.ExtractMinimum();
+            }
+        }
+        heap.Merge(other);
+        auto corrupted = heap.CorruptedItems();
+        EXPECT_LE(static_cast<double>(corrupted.size()), epsilon * static_cast<double>(inserted));
+        EXPECT_EQ(heap.Data().size(), heap.Size());
+        EXPECT_THROW(heap.Merge(heap), heaps::SelfHeapMergeException);
+    }
+    heaps::SoftHeap<int> empty;
+    EXPECT_THROW(empty.GetMinimum(), heaps::EmptyHeapException);
+    EXPECT_THROW(empty.ExtractMinimum(), heaps::EmptyHeapException);
+}
+
+TEST(SoftHeap, Selection) {
+    std::mt19937 gen(31);
+    for (size_t n: {1, 10, 65, 1000, 100'000}) {
+        std::vector<int> keys(n);
+        for (auto &key: keys) {
+            key = static_cast<int>(gen() % (n + 7));
+        }
+        for (size_t k: {size_t(0), n / 3, n / 2, n - 1}) {
+            auto sorted = keys;
+            std::nth_element(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(k), sorted.end());
+            ASSERT_EQ(heaps::SoftSelect(keys, k), sorted[k]);
+        }
+        EXPECT_THROW(heaps::SoftSelect(keys, n), std::out_of_range);
+    }
+}
+
+// Random graph with vertices 0..n-1 and weights in [0, max_weight)
+std::vector<heaps::Edge<int64_t>> RandomEdges(size_t n, size_t m, int64_t max_weight, std::mt19937 &gen) {
+    std::vector<heaps::Edge<int64_t>> edges(m);
+    for (auto &edge: edges) {
+        edge = {static_cast<uint32_t>(gen() % n), static_cast<uint32_t>(gen() % n),
+                static_cast<int64_t>(gen() % max_weight)};
+    }
+    return edges;
+}
+
+// Minimal keys are taken from the heaps templated on the key type, all of them must agree with references.
+template<template<class> class Heap>
+void TestAlgorithms() {
+    std::mt19937 gen(33);
+    const size_t n = 300;
+    auto edges = RandomEdges(n, 3000, 1000, gen);
+
+    // Bellman-Ford
+    heaps::CsrGraph<int64_t> graph(n, edges);
+    std::vector<int64_t> distance(n, heaps::kUnreachable<int64_t>);
+    distance[0] = 0;
+    for (size_t step = 0; step < n; ++step) {
+        for (const auto &edge: edges) {
+            if (distance[edge.from_] != heaps::kUnreachable<int64_t>) {
+                distance[edge.to_] = std::min(distance[edge.to_], distance[edge.from_] + edge.weight_);
+            }
+        }
+    }
+    EXPECT_EQ(heaps::Dijkstra<Heap>(graph, 0), distance);
+
+    // Kruskal
+    heaps::CsrGraph<int64_t> undirected(n, edges, true);
+    auto sorted_edges = edges;
+    std::sort(sorted_edges.begin(), sorted_edges.end(), [](const auto &a, const auto &b) {
+        return a.weight_ < b.weight_;
+    });
+    heaps::detail::DisjointSets components(n);
+    int64_t forest_weight = 0;
+    for (const auto &edge: sorted_edges) {
+        forest_weight += components.Join(edge.from_, edge.to_) ? edge.weight_ : 0;
+    }
+    auto forest = heaps::Prim<Heap>(undirected);
+    EXPECT_EQ(forest.weight_, forest_weight);
+
+    // Huffman: the cost is the same as with std::multiset, lengths satisfy the Kraft equality.
+    std::vector<uint64_t> frequencies(1000);
+    for (auto &frequency: frequencies) {
+        frequency = gen() % 10'000;
+    }
+    auto lengths = heaps::HuffmanCodeLengths<Heap>(frequencies);
+    auto reference = heaps::HuffmanCodeLengths<heaps::StlHeap>(frequencies);
+    uint64_t cost = 0, reference_cost = 0;
+    double kraft = 0;
+    for (size_t i = 0; i < frequencies.size(); ++i) {
+        cost += frequencies[i] * lengths[i];
+        reference_cost += frequencies[i] * reference[i];
+        kraft += std::ldexp(1.0, -static_cast<int>(lengths[i]));
+    }
+    EXPECT_EQ(cost, reference_cost);
+    EXPECT_DOUBLE_EQ(kraft, 1.0);
+
+    // K-way merge
+    std::vector<std::vector<int>> runs(50);
+    std::vector<int> all;
+    for (auto &run: runs) {
+        run.resize(gen() % 100);
+        for (auto &value: run) {
+            value = static_cast<int>(gen() % 500);
+            all.push_back(value);
+        }
+        std::sort(run.begin(), run.end());
+    }
+    std::sort(all.begin(), all.end());
+    EXPECT_EQ(heaps::KWayMerge<Heap>(runs), all);
+
+    // Arborescence against the exhaustive search over the incoming edges of every vertex
+    for (int test = 0; test < 200; ++test) {
+        const size_t k = 2 + gen() % 5;
+        auto small_edges = RandomEdges(k, 2 + gen() % 16, 10, gen);
+        std::vector<std::vector<heaps::Edge<int64_t>>> incoming(k);
+        for (const auto &edge: small_edges) {
+            incoming[edge.to_].push_back(edge);
+        }
+        int64_t best = std::numeric_limits<int64_t>::max();
+        std::vector<size_t> choice(k, 0);
+        while (true) {
+            bool valid = true;
+            int64_t weight = 0;
+            for (size_t v = 1; v < k && valid; ++v) {
+                valid = choice[v] < incoming[v].size();
+                weight += valid ? incoming[v][choice[v]].weight_ : 0;
+            }
+            // Every vertex must reach the root 0 going by the chosen parents.
+            for (size_t v = 1; v < k && valid; ++v) {
+                size_t u = v;
+                for (size_t steps = 0; steps < k && u != 0; ++steps) {
+                    u = incoming[u][choice[u]].from_;
+                }
+                valid = u == 0;
+            }
+            if (valid) {
+                best = std::min(best, weight);
+            }
+            size_t v = 1;
+            while (v < k && ++choice[v] >= std::max<size_t>(incoming[v].size(), 1)) {
+                choice[v++] = 0;
+            }
+            if (v >= k) {
+                break;
+            }
+        }
+        if (best == std::numeric_limits<int64_t>::max()) {
+            EXPECT_THROW(heaps::MinimumArborescence<Heap>(k, small_edges, 0), heaps::NoArborescenceException);
+        } else {
+            EXPECT_EQ(heaps::MinimumArborescence<Heap>(k, small_edges, 0), best);
+        }
+    }
+}
+
+TEST(Algorithms, LeftistHeap) {
+    TestAlgorithms<heaps::LeftistHeap>();
+}
+
+TEST(Algorithms, SkewHeap) {
+    TestAlgorithms<heaps::SkewHeap>();
+}
+
+TEST(Algorithms, BinomialHeap) {
+    TestAlgorithms<heaps::BinomialHeap>();
+}
+
+TEST(Algorithms, SkewBinomialHeap) {
+    TestAlgorithms<heaps::SkewBinomialHeap>();
+}
+
+TEST(Algorithms, RandomizedMeldableHeap) {
+    TestAlgorithms<heaps::RandomizedMeldableHeap>();
+}
+
+TEST(Algorithms, StlHeap) {
+    TestAlgorithms<heaps::StlHeap>();
+}
+
+// Splits the heap repeatedly and checks, that the parts hold all the keys and stay heaps.
+template<typename T>
+void TestSplitLeftSubtree(size_t keys_cnt) {
+    std::mt19937 gen(keys_cnt);
+    T heap;
+    std::vector<int> keys(keys_cnt);
+    for (auto &key: keys) {
+        key = static_cast<int>(gen() % 1000);
+        heap.Insert(key);
+    }
+    std::vector<decltype(heap.SplitLeftSubtree())> parts;
+    size_t total = 0;
+    // Inline keys and the root without children are not split.
+    for (auto part = heap.SplitLeftSubtree(); !part.Empty(); part = heap.SplitLeftSubtree()) {
+        total += part.Size();
+        parts.push_back(std::move(part));
+    }
+    EXPECT_EQ(total + heap.Size(), keys_cnt);
+    std::vector<int> extracted;
+    for (auto &part: parts) {
+        std::vector<int> sorted;
+        while (!part.Empty()) {
+            sorted.push_back(part.GetMinimum());
+            part.ExtractMinimum();
+        }
+        EXPECT_TRUE(std::is_sorted(sorted.begin(), sorted.end()));
+        extracted.insert(extracted.end(), sorted.begin(), sorted.end());
+    }
+    while (!heap.Empty()) {
+        extracted.push_back(heap.GetMinimum());
+        heap.ExtractMinimum();
+    }
+    std::sort(keys.begin(), keys.end());
+    std::sort(extracted.begin(), extracted.end());
+    EXPECT_EQ(extracted, keys);
+}
+
+TEST(WorkStealing, SplitLeftSubtree) {
+    TestSplitLeftSubtree<heaps::LeftistHeap<int>>(1000);
+    TestSplitLeftSubtree<heaps::SkewHeap<int>>(1000);
+    TestSplitLeftSubtree<heaps::LeftistHeap<int, 8>>(5);
+    TestSplitLeftSubtree<heaps::WeightBiasedLeftistHeap<int>>(1000);
+}
+
+// Subtree sizes keep Size() exact after the splits and lead Sample to every key equally often.
+TEST(WeightBiasedLeftistHeap, SizeAndSample) {
+    heaps::WeightBiasedLeftistHeap<int> heap;
+    for (int i = 0; i < 64; ++i) {
+        heap.Insert(63 - i);
+    }
+    TestSortedExtraction<heaps::WeightBiasedLeftistHeap<int>, int>(10'000);
+    TestSortedExtraction<heaps::WeightBiasedLeftistHeap<int, 8>, int>(10'000);
+    heaps::WeightBiasedLeftistHeap<int> copy(heap);
+    auto part = copy.SplitLeftSubtree();
+    EXPECT_EQ(copy.Size() + part.Size(), 64u);
+
+    std::mt19937 gen(64);
+    std::vector<size_t> hits(64);
+    constexpr size_t kSamples = 64'000;
+    for (size_t i = 0; i < kSamples; ++i) {
+        ++hits[heap.Sample(gen)];
+    }
+    for (size_t count: hits) {
+        EXPECT_GT(count, kSamples / 64 / 2);
+        EXPECT_LT(count, kSamples / 64 * 2);
+    }
+    heaps::WeightBiasedLeftistHeap<int, 4> small(7);
+    EXPECT_EQ(small.Sample(gen), 7);
+    small.ExtractMinimum();
+    EXPECT_THROW(small.Sample(gen), heaps::EmptyHeapException);
+}
+
+// Runs a fork-join tree of tasks, every task is run exactly once.
+template<template<class> class Heap>
+void TestScheduler(size_t workers_cnt) {
+    heaps::WorkStealingScheduler<Heap> scheduler(workers_cnt);
+    constexpr int kDepth = 12;
+    std::atomic<size_t> finished{0};
+    // Largest queue depth seen by the tasks, a counter decremented before its increment wraps around.
+    std::atomic<size_t> max_depth{0};
+    std::function<void(int)> spawn = [&](int depth) {
+        finished++;
+        for (size_t i = 0; i < scheduler.WorkersCount(); ++i) {
+            size_t seen = max_depth;
+            const size_t current = scheduler.QueueDepth(i);
+            while (seen < current && !max_depth.compare_exchange_weak(seen, current)) {}
+        }
+        if (depth > 0) {
+            scheduler.Submit(depth, [&spawn, depth] { spawn(depth - 1); });
+            scheduler.Submit(depth, [&spawn, depth] { spawn(depth - 1); });
+        }
+    };
+    for (int i = 0; i < 4; ++i) {
+        scheduler.Submit(0, [&spawn] { spawn(kDepth); });
+    }
+    scheduler.Wait();
+    EXPECT_EQ(finished.load(), 4 * ((size_t(1) << (kDepth + 1)) - 1));
+    EXPECT_LE(max_depth.load(), finished.load());
+    size_t stolen = 0;
+    for (size_t i = 0; i < scheduler.WorkersCount(); ++i) {
+        EXPECT_EQ(scheduler.QueueDepth(i), 0u);
+        stolen += scheduler.StolenTasks(i);
+        EXPECT_LE(scheduler.StealCount(i), scheduler.StolenTasks(i));
+    }
+    EXPECT_LE(stolen, finished.load());
+}
+
+TEST(WorkStealing, Scheduler) {
+    TestScheduler<heaps::LeftistHeap>(4);
+    TestScheduler<heaps::SkewHeap>(3);
+}
+
+TEST(WorkStealing, PriorityOrder) {
+    heaps::WorkStealingScheduler<> scheduler(1);
+    std::vector<int64_t> order;
+    scheduler.Submit(0, [&] {
+        for (int64_t priority: {5, 3, 9, 1, 3, 7}) {
+            scheduler.Submit(priority, [&order, priority] { order.push_back(priority); });
+        }
+    });
+    scheduler.Wait();
+    EXPECT_EQ(order, (std::vector<int64_t>{1, 3, 3, 5, 7, 9}));
+    EXPECT_EQ(scheduler.StealCount(0), 0u);
+}
+
+// Schedules, cancels, expires and melds timers in two queues, the reference keeps the deadline of every live timer.
+template<template<class> class Heap>
+void TestTimerQueue(size_t actions_cnt) {
+    using Queue = heaps::TimerQueue<uint64_t, uint32_t, Heap>;
+    std::mt19937 gen(actions_cnt);
+    std::vector<Queue> queues(2);
+    // Live timers of each queue: id -> (deadline, handle)
+    std::vector<std::map<uint32_t, std::pair<uint64_t, typename Queue::Handle>>> live(2);
+    // Handles by id, ids of the other actions keep the default handle.
+    std::vector<typename Queue::Handle> handles(actions_cnt);
+    uint64_t now = 0;
+    for (uint32_t id = 0; id < actions_cnt; ++id) {
+        const size_t q = gen() % 2;
+        const size_t action = gen() % 10;
+        if (action < 5) {
+            uint64_t deadline = now + gen() % 1000;
+            handles[id] = queues[q].Schedule(deadline, id);
+            live[q][id] = {deadline, handles[id]};
+        } else if (action < 8) {
+            // The handle is cancelled in the queue, which owns the timer now.
+            const uint32_t victim = gen() % (id + 1);
+            const size_t owner = live[1 - q].count(victim) > 0 ? 1 - q : q;
+            bool expected = live[owner].erase(victim) > 0;
+            EXPECT_EQ(queues[owner].Cancel(handles[victim]), expected);
+        } else if (action < 9) {
+            now += gen() % 100;
+            std::vector<uint32_t> fired;
+            uint64_t last = 0;
+            size_t fired_cnt = queues[q].ExpireUntil(now, [&](uint32_t timer) {
+                EXPECT_LE(last, live[q].at(timer).first);
+                last = live[q].at(timer).first;
+                fired.push_back(timer);
+            });
+            EXPECT_EQ(fired_cnt, fired.size());
+            std::vector<uint32_t> expected;
+            for (const auto &[timer, state]: live[q]) {
+                if (state.first <= now) {
+                    expected.push_back(timer);
+                }
+            }
+            for (uint32_t timer: expected) {
+                live[q].erase(timer);
+            }
+            std::sort(fired.begin(), fired.end());
+            EXPECT_EQ(fired, expected);
+        } else {
+            queues[q].Merge(queues[1 - q]);
+            live[q].merge(live[1 - q]);
+        }
+        EXPECT_EQ(queues[q].Size(), live[q].size());
+        if (!live[q].empty()) {
+            uint64_t next = std::numeric_limits<uint64_t>::max();
+            for (const auto &[timer, state]: live[q]) {
+                next = std::min(next, state.first);
+            }
+            EXPECT_EQ(queues[q].NextDeadline(), next);
+        } else {
+            EXPECT_THROW(queues[q].NextDeadline(), heaps::EmptyHeapException);
+        }
+    }
+}
+
+TEST(TimerQueue, LazyBinomialHeap) {
+    TestTimerQueue<heaps::LazyBinomialHeap>(20000);
+}
+
+TEST(TimerQueue, LeftistHeap) {
+    TestTimerQueue<heaps::LeftistHeap>(20000);
+}
+
+TEST(TimerQueue, CallbacksReenter) {
+    heaps::TimerQueue<int, int> queue;
+    auto first = queue.Schedule(1, 1);
+    queue.Schedule(2, 2);
+    std::vector<int> fired;
+    queue.ExpireUntil(2, [&](int timer) {
+        fired.push_back(timer);
+        EXPECT_FALSE(queue.Cancel(first));
+        queue.Schedule(2, 10 + timer);
+    });
+    EXPECT_EQ(fired, (std::vector<int>{1, 2}));
+    EXPECT_EQ(queue.Size(), 2u);
+    EXPECT_EQ(queue.ExpireUntil(2, [](int) {}), 2u);
+    EXPECT_TRUE(queue.Empty());
+}
+
+TEST_F(TestCase, DoubleEndedHeapTest) {
+    TestHeap<heaps::DoubleEndedHeap<SimpleKey>>(actions_);
+}
+
+TEST(DoubleEndedHeap, MinAndMax) {
+    std::mt19937 gen(7);
+    std::vector<heaps::DoubleEndedHeap<int>> heaps(4);
+    std::vector<std::multiset<int>> reference(4);
+    for (size_t i = 0; i < 100000; ++i) {
+        const size_t h = gen() % heaps.size();
+        // Merges are rare, the reference melds in O(n log n).
+        const size_t action = gen() % 64;
+        if (action < 32) {
+            int key = static_cast<int>(gen() % 1000);
+            heaps[h].Insert(key);
+            reference[h].insert(key);
+        } else if (action < 63 && !reference[h].empty()) {
+            EXPECT_EQ(heaps[h].GetMinimum(), *reference[h].begin());
+            EXPECT_EQ(heaps[h].GetMaximum(), *reference[h].rbegin());
+            if (action % 2 == 0) {
+                heaps[h].ExtractMinimum();
+                reference[h].erase(reference[h].begin());
+            } else {
+                heaps[h].ExtractMaximum();
+                reference[h].erase(std::prev(reference[h].end()));
+            }
+        } else if (action == 63) {
+            const size_t other = (h + 1) % heaps.size();
+            heaps[h].Merge(heaps[other]);
+            reference[h].insert(reference[other].begin(), reference[other].end());
+            reference[other].clear();
+        }
+        EXPECT_EQ(heaps[h].Size(), reference[h].size());
+    }
+    for (size_t h = 0; h < heaps.size(); ++h) {
+        auto copy = heaps[h];
+        EXPECT_EQ(copy.Data(), std::vector<int>(reference[h].begin(), reference[h].end()));
+        while (!heaps[h].Empty()) {
+            EXPECT_EQ(heaps[h].GetMaximum(), *reference[h].rbegin());
+            heaps[h].ExtractMaximum();
+            reference[h].erase(std::prev(reference[h].end()));
+        }
+    }
+    EXPECT_THROW(heaps[0].GetMaximum(), heaps::EmptyHeapException);
+}
+
+TEST_F(TestCase, TombstoneHeapTest) {
+    TestHeap<heaps::TombstoneHeap<SimpleKey>>(actions_);
+}
+
+// Deletes items by handles and by predicate in two heaps, which are melded from time to time.
+template<template<class> class Heap, class Key = int>
+void TestTombstones(size_t actions_cnt) {
+    using TombstoneHeap = heaps::TombstoneHeap<Key, Heap>;
+    std::mt19937 gen(actions_cnt);
+    std::vector<TombstoneHeap> heaps(2);
+    // Live items of each heap: id -> key
+    std::vector<std::map<size_t, Key>> live(2);
+    std::vector<typename TombstoneHeap::Handle> handles(actions_cnt);
+    for (size_t id = 0; id < actions_cnt; ++id) {
+        const size_t h = gen() % 2;
+        const size_t action = gen() % 32;
+        if (action < 16) {
+            // Keys are unique, so the extracted item is known.
+            Key key = static_cast<Key>((gen() % 10000) * actions_cnt + id);
+            handles[id] = heaps[h].InsertWithHandle(key);
+            live[h][id] = key;
+        } else if (action < 26) {
+            const size_t victim = gen() % (id + 1);
+            const size_t owner = live[1 - h].count(victim) > 0 ? 1 - h : h;
+            EXPECT_EQ(heaps[owner].MarkDeleted(handles[victim]), live[owner].erase(victim) > 0);
+        } else if (action < 30) {
+            if (!live[h].empty()) {
+                auto minimum = std::min_element(live[h].begin(), live[h].end(), [](auto &a, auto &b) {
+                    return a.second < b.second;
+                });
+                EXPECT_EQ(heaps[h].GetMinimum(), minimum->second);
+                heaps[h].ExtractMinimum();
+                live[h].erase(minimum);
+            } else {
+                EXPECT_THROW(heaps[h].ExtractMinimum(), heaps::EmptyHeapException);
+            }
+        } else if (action < 31) {
+            const int divisor = 2 + static_cast<int>(gen() % 5);
+            size_t expected = 0;
+            for (auto it = live[h].begin(); it != live[h].end();) {
+                if (static_cast<int64_t>(it->second) % divisor == 0) {
+                    it = live[h].erase(it);
+                    ++expected;
+                } else {
+                    ++it;
+                }
+            }
+            EXPECT_EQ(heaps[h].EraseIf([divisor](Key key) { return static_cast<int64_t>(key) % divisor == 0; }),
+                      expected);
+        } else {
+            heaps[h].Merge(heaps[1 - h]);
+            live[h].merge(live[1 - h]);
+        }
+        EXPECT_EQ(heaps[h].LiveCount(), live[h].size());
+        EXPECT_LE(heaps[h].DeadCount(), std::max<size_t>(64, heaps[h].LiveCount() + 1));
+    }
+    for (size_t h = 0; h < 2; ++h) {
+        std::vector<Key> expected;
+        for (const auto &item: live[h]) {
+            expected.push_back(item.second);
+        }
+        std::sort(expected.begin(), expected.end());
+        EXPECT_EQ(heaps[h].Data(), expected);
+        heaps[h].Compact();
+        EXPECT_EQ(heaps[h].DeadCount(), 0u);
+        std::vector<Key> extracted;
+        while (!heaps[h].Empty()) {
+            extracted.push_back(heaps[h].GetMinimum());
+            heaps[h].ExtractMinimum();
+        }
+        EXPECT_EQ(extracted, expected);
+    }
+}
+
+TEST(TombstoneHeap, LeftistHeap) {
+    TestTombstones<heaps::LeftistHeap>(30000);
+}
+
+TEST(TombstoneHeap, SkewHeap) {
+    TestTombstones<heaps::SkewHeap>(30000);
+}
+
+TEST(TombstoneHeap, BinomialHeap) {
+    TestTombstones<heaps::BinomialHeap>(30000);
+}
+
+// The one-item constructor takes a floating point key, the dead fraction is set by the factory.
+TEST(TombstoneHeap, DoubleKeys) {
+    TestTombstones<heaps::LeftistHeap, double>(30000);
+    heaps::TombstoneHeap<double> one(0.5);
+    EXPECT_EQ(one.Size(), 1u);
+    EXPECT_EQ(one.GetMinimum(), 0.5);
+    // Half of the items are deleted: the default heap keeps them, the eager one compacts at the minimal number.
+    auto eager = heaps::TombstoneHeap<double>::WithDeadFraction(0.0);
+    heaps::TombstoneHeap<double> lazy;
+    for (auto *heap: {&eager, &lazy}) {
+        std::vector<heaps::TombstoneHeap<double>::Handle> handles;
+        for (int i = 0; i < 200; ++i) {
+            handles.push_back(heap->InsertWithHandle(i + 0.5));
+        }
+        for (int i = 199; i >= 0; i -= 2) {
+            heap->MarkDeleted(handles[i]);
+        }
+        EXPECT_EQ(heap->Size(), 100u);
+        EXPECT_EQ(heap->GetMinimum(), 0.5);
+    }
+    EXPECT_LT(eager.DeadCount(), 64u);
+    EXPECT_EQ(lazy.DeadCount(), 100u);
+}
+
+// Converts a heap with random keys to the target type and merges another one into a heap of the target type.
+template<typename Source, typename Target>
+void TestConversion(size_t keys_cnt) {
+    std::mt19937 gen(keys_cnt);
+    Source source, other;
+    std::vector<int> keys(keys_cnt);
+    for (size_t i = 0; i < keys_cnt; ++i) {
+        keys[i] = static_cast<int>(gen() % 1000);
+        (i % 2 == 0 ? source : other).Insert(keys[i]);
+    }
+    Target target = heaps::ConvertTo<Target>(source);
+    EXPECT_TRUE(source.Empty());
+    heaps::MergeInto(target, other);
+    EXPECT_TRUE(other.Empty());
+    std::sort(keys.begin(), keys.end());
+    EXPECT_EQ(target.Size(), keys_cnt);
+    EXPECT_EQ(target.Data(), keys);
+    std::vector<int> extracted;
+    while (!target.Empty()) {
+        extracted.push_back(target.GetMinimum());
+        target.ExtractMinimum();
+    }
+    EXPECT_EQ(extracted, keys);
+}
+
+TEST(Conversion, ConvertAndMerge) {
+    static_assert(heaps::detail::HasTakeKeys<heaps::LeftistHeap<int>>::value);
+    static_assert(heaps::detail::HasTakeKeys<heaps::BinomialHeap<int>>::value);
+    static_assert(heaps::detail::HasTakeKeys<heaps::BlockedSkewHeap<int, 8>>::value);
+    static_assert(!heaps::detail::HasTakeKeys<heaps::StlHeap<int>>::value);
+    for (size_t keys_cnt: {0, 1, 7, 1000}) {
+        TestConversion<heaps::LeftistHeap<int>, heaps::BinomialHeap<int>>(keys_cnt);
+        TestConversion<heaps::BinomialHeap<int>, heaps::SkewHeap<int>>(keys_cnt);
+        TestConversion<heaps::SkewHeap<int>, heaps::LazyBinomialHeap<int>>(keys_cnt);
+        TestConversion<heaps::LazyBinomialHeap<int>, heaps::RootTableBinomialHeap<int>>(keys_cnt);
+        TestConversion<heaps::RootTableBinomialHeap<int>, heaps::BlockedLeftistHeap<int, 8>>(keys_cnt);
+        TestConversion<heaps::BlockedSkewHeap<int, 8>, heaps::LeftistHeap<int, 8>>(keys_cnt);
+        TestConversion<heaps::BinomialHeap<int, 8>, heaps::LeftistHeap<int>>(keys_cnt);
+        TestConversion<heaps::StlHeap<int>, heaps::SkewHeap<int>>(keys_cnt);
+        TestConversion<heaps::LeftistHeap<int>, heaps::LeftistHeap<int>>(keys_cnt);
+    }
+}
+
+TEST(Conversion, PendingTags) {
+    heaps::LeftistHeap<int> source;
+    for (int i = 0; i < 100; ++i) {
+        source.Insert(i);
+        source.AddToAll(1);
+    }
+    auto target = heaps::ConvertTo<heaps::BinomialHeap<int>>(source);
+    // Key i got 100 - i additions.
+    EXPECT_EQ(target.Data(), std::vector<int>(100, 100));
+}
+
+// Payload, which counts its copies
+struct CountedPayload {
+    inline static size_t copies_ = 0;
+    std::string text_;
+
+    CountedPayload() = default;
+
+    explicit CountedPayload(std::string text) : text_(std::move(text)) {}
+
+    CountedPayload(const CountedPayload &other) : text_(other.text_) {
+        ++copies_;
+    }
+
+    CountedPayload(CountedPayload &&other) noexcept = default;
+
+    CountedPayload &operator=(const CountedPayload &other) {
+        text_ = other.text_;
+        ++copies_;
+        return *this;
+    }
+
+    CountedPayload &operator=(CountedPayload &&other) noexcept = default;
+};
+
+// Pushes, pops and merges the heaps with the shared and with the own slabs, values are never copied.
+template<template<class> class Heap>
+void TestPayloadHeap(size_t actions_cnt) {
+    using PayloadHeap = heaps::PayloadHeap<int, CountedPayload, Heap>;
+    std::mt19937 gen(actions_cnt);
+    auto shared = std::make_shared<heaps::PayloadSlab<CountedPayload>>();
+    std::vector<PayloadHeap> heaps;
+    heaps.emplace_back(shared);
+    heaps.emplace_back(shared);
+    heaps.emplace_back();
+    std::vector<std::multiset<std::pair<int, std::string>>> reference(heaps.size());
+    CountedPayload::copies_ = 0;
+    for (size_t i = 0; i < actions_cnt; ++i) {
+        const size_t h = gen() % heaps.size();
+        const size_t action = gen() % 16;
+        if (action < 8) {
+            int priority = static_cast<int>(gen() % 1000);
+            // Values are unique, equal priorities are resolved by the values in the reference.
+            std::string text = std::to_string(priority) + "#" + std::to_string(i);
+            heaps[h].Push(priority, CountedPayload(text));
+            reference[h].emplace(priority, text);
+        } else if (action < 15) {
+            if (reference[h].empty()) {
+                EXPECT_THROW(heaps[h].PopMin(), heaps::EmptyHeapException);
+                continue;
+            }
+            const int priority = heaps[h].TopPriority();
+            EXPECT_EQ(priority, reference[h].begin()->first);
+            auto [popped_priority, value] = heaps[h].PopMin();
+            EXPECT_EQ(popped_priority, priority);
+            auto it = reference[h].find({priority, value.text_});
+            ASSERT_NE(it, reference[h].end());
+            reference[h].erase(it);
+        } else {
+            const size_t other = (h + 1) % heaps.size();
+            heaps[h].Merge(heaps[other]);
+            reference[h].insert(reference[other].begin(), reference[other].end());
+            reference[other].clear();
+        }
+        EXPECT_EQ(heaps[h].Size(), reference[h].size());
+    }
+    EXPECT_EQ(CountedPayload::copies_, 0u);
+    size_t shared_cnt = reference[0].size() + reference[1].size();
+    EXPECT_EQ(shared->Size(), shared_cnt);
+    heaps.erase(heaps.begin());
+    EXPECT_EQ(shared->Size(), shared_cnt - reference[0].size());
+}
+
+TEST(PayloadHeap, LeftistHeap) {
+    TestPayloadHeap<heaps::LeftistHeap>(20000);
+}
+
+TEST(PayloadHeap, BinomialHeap) {
+    TestPayloadHeap<heaps::BinomialHeap>(20000);
+}
+
+TEST(PayloadHeap, StlHeap) {
+    TestPayloadHeap<heaps::StlHeap>(5000);
+}
+
+// Random offers, extractions and merges on bounded heaps of different capacities and policies.
+// The reference keeps the capacity greatest keys in a std::multiset.
+template<template<class> class Heap>
+void TestBoundedHeap(size_t actions_cnt) {
+    using BoundedHeap = heaps::BoundedHeap<int, Heap>;
+    std::mt19937 gen(actions_cnt);
+    std::vector<BoundedHeap> heaps{BoundedHeap(50), BoundedHeap(200), BoundedHeap(50, heaps::OverflowPolicy::kReject)};
+    std::vector<std::multiset<int>> reference(heaps.size());
+    auto trim = [&](size_t h) {
+        while (reference[h].size() > heaps[h].Capacity()) {
+            reference[h].erase(reference[h].begin());
+        }
+    };
+    for (size_t i = 0; i < actions_cnt; ++i) {
+        const size_t h = gen() % heaps.size();
+        const size_t action = gen() % 64;
+        if (action < 56) {
+            const int key = static_cast<int>(gen() % 1000);
+            bool kept = reference[h].size() < heaps[h].Capacity() ||
+                        (h != 2 && *reference[h].begin() < key);
+            EXPECT_EQ(heaps[h].Offer(key), kept);
+            if (kept) {
+                reference[h].insert(key);
+                trim(h);
+            }
+        } else if (action < 62) {
+            if (reference[h].empty()) {
+                EXPECT_THROW(heaps[h].Boundary(), heaps::EmptyHeapException);
+                continue;
+            }
+            EXPECT_EQ(heaps[h].Boundary(), *reference[h].begin());
+            heaps[h].ExtractBoundary();
+            reference[h].erase(reference[h].begin());
+        } else {
+            const size_t other = (h + 1) % heaps.size();
+            heaps[h].Merge(heaps[other]);
+            reference[h].insert(reference[other].begin(), reference[other].end());
+            reference[other].clear();
+            trim(h);
+        }
+        ASSERT_EQ(heaps[h].Size(), reference[h].size());
+        EXPECT_EQ(heaps[h].ByteUsage(), sizeof(BoundedHeap) + reference[h].size() * BoundedHeap::kBytesPerKey);
+    }
+    for (size_t h = 0; h < heaps.size(); ++h) {
+        std::vector<int> expected(reference[h].rbegin(), reference[h].rend());
+        EXPECT_EQ(heaps[h].TakeBest(), expected);
+        EXPECT_TRUE(heaps[h].Empty());
+    }
+}
+
+TEST(BoundedHeap, LeftistHeap) {
+    TestBoundedHeap<heaps::LeftistHeap>(50000);
+}
+
+TEST(BoundedHeap, BinomialHeap) {
+    TestBoundedHeap<heaps::BinomialHeap>(50000);
+}
+
+TEST(BoundedHeap, StlHeap) {
+    TestBoundedHeap<heaps::StlHeap>(20000);
+}
+
+// Compares random pairs of keys: the prefixes keep the order and NormalizedKey orders as Key.
+template<typename Key, typename Generator>
+void TestNormalizer(Generator generate) {
+    using Normalizer = heaps::KeyNormalizer<Key>;
+    std::mt19937 gen(Normalizer::kBits);
+    for (int i = 0; i < 10'000; ++i) {
+        const Key a = generate(gen), b = generate(gen);
+        const uint64_t prefix_a = Normalizer::Prefix(a), prefix_b = Normalizer::Prefix(b);
+        if (a < b) {
+            ASSERT_LE(prefix_a, prefix_b);
+        }
+        if (prefix_a < prefix_b) {
+            ASSERT_TRUE(a < b);
+        }
+        if (Normalizer::kExact && prefix_a == prefix_b) {
+            ASSERT_FALSE(a < b || b < a);
+        }
+        ASSERT_EQ(heaps::NormalizedKey<Key>(a) < heaps::NormalizedKey<Key>(b), a < b);
+        if constexpr (Normalizer::kBits < 64) {
+            ASSERT_EQ(prefix_a & (~uint64_t(0) >> Normalizer::kBits), 0u);
+        }
+    }
+}
+
+// Strings from a small alphabet, so the long common prefixes are frequent.
+std::string RandomString(std::mt19937 &gen) {
+    std::string text(gen() % 12, 'a');
+    for (auto &c: text) {
+        c = static_cast<char>("ab\0\xff"[gen() % 4]);
+    }
+    return text;
+}
+
+// Tells, if KeyNormalizer<Key> is defined.
+template<class Key, class = void>
+struct HasNormalizer : std::false_type {};
+
+template<class Key>
+struct HasNormalizer<Key, std::void_t<decltype(heaps::KeyNormalizer<Key>::kBits)>> : std::true_type {};
+
+// Case-insensitive order, which the byte prefixes don't keep.
+struct CaseInsensitiveTraits : std::char_traits<char> {
+    static bool lt(char a, char b) {
+        return std::tolower(static_cast<unsigned char>(a)) < std::tolower(static_cast<unsigned char>(b));
+    }
+};
+
+TEST(NormalizedKey, Normalizers) {
+    static_assert(HasNormalizer<std::string>::value);
+    static_assert(!HasNormalizer<std::basic_string<char, CaseInsensitiveTraits>>::value);
+    TestNormalizer<int>([](std::mt19937 &gen) { return static_cast<int>(gen()); });
+    TestNormalizer<int8_t>([](std::mt19937 &gen) { return static_cast<int8_t>(gen()); });
+    TestNormalizer<uint64_t>([](std::mt19937 &gen) { return (uint64_t(gen()) << 32) | gen(); });
+    TestNormalizer<int64_t>([](std::mt19937 &gen) { return static_cast<int64_t>((uint64_t(gen()) << 32) | gen()); });
+    TestNormalizer<float>([](std::mt19937 &gen) { return std::uniform_real_distribution<float>(-10, 10)(gen); });
+    TestNormalizer<double>([](std::mt19937 &gen) {
+        return gen() % 4 == 0 ? (gen() % 2 == 0 ? 0.0 : -0.0) : std::uniform_real_distribution<double>(-1e9, 1e9)(gen);
+    });
+    TestNormalizer<std::string>(RandomString);
+    TestNormalizer<std::pair<int16_t, std::string>>([](std::mt19937 &gen) {
+        return std::make_pair(static_cast<int16_t>(gen() % 3), RandomString(gen));
+    });
+    using Task = std::tuple<uint16_t, int8_t, double, uint32_t>;
+    static_assert(heaps::KeyNormalizer<Task>::kBits == 64 && !heaps::KeyNormalizer<Task>::kExact);
+    static_assert(heaps::KeyNormalizer<std::tuple<uint16_t, int8_t, int>>::kExact);
+    TestNormalizer<Task>([](std::mt19937 &gen) {
+        return Task(gen() % 2, static_cast<int8_t>(gen() % 3), gen() % 3 * 0.5, gen() % 4);
+    });
+}
+
+TEST(NormalizedKey, Heaps) {
+    TestSortedExtraction<heaps::LeftistHeap<heaps::NormalizedKey<int>>, heaps::NormalizedKey<int>>(10'000);
+    TestSortedExtraction<heaps::BinomialHeap<heaps::NormalizedKey<double>>, heaps::NormalizedKey<double>>(10'000);
+    std::mt19937 gen(43);
+    heaps::BinomialHeap<heaps::NormalizedKey<std::string>> heap;
+    std::vector<std::string> keys(5'000);
+    for (auto &key: keys) {
+        key = RandomString(gen);
+        heap.Insert(key);
+    }
+    std::sort(keys.begin(), keys.end());
+    for (const auto &key: keys) {
+        ASSERT_EQ(heap.GetMinimum().Get(), key);
+        heap.ExtractMinimum();
+    }
+}
+
+// Producers push batches, consumers pop until the channel is closed: every key is popped exactly once.
+template<template<class> class Heap>
+void TestPriorityChannel(size_t producers_cnt, size_t consumers_cnt, size_t batches_cnt) {
+    heaps::PriorityChannel<int, Heap> channel;
+    std::vector<std::vector<int>> popped(consumers_cnt);
+    std::vector<std::thread> consumers;
+    for (size_t i = 0; i < consumers_cnt; ++i) {
+        consumers.emplace_back([&channel, &keys = popped[i]] {
+            while (auto key = channel.Pop()) {
+                keys.push_back(*key);
+            }
+        });
+    }
+    std::vector<std::thread> producers;
+    for (size_t i = 0; i < producers_cnt; ++i) {
+        producers.emplace_back([&channel, i, batches_cnt] {
+            std::mt19937 gen(i);
+            for (size_t batch = 0; batch < batches_cnt; ++batch) {
+                std::vector<int> keys(gen() % 64);
+                for (auto &key: keys) {
+                    key = static_cast<int>(gen() % 1000);
+                }
+                channel.PushBatch(keys);
+            }
+        });
+    }
+    for (auto &producer: producers) {
+        producer.join();
+    }
+    channel.Close();
+    for (auto &consumer: consumers) {
+        consumer.join();
+    }
+    EXPECT_THROW(channel.Push(0), heaps::ClosedChannelException);
+    std::vector<int> expected, actual;
+    for (size_t i = 0; i < producers_cnt; ++i) {
+        std::mt19937 gen(i);
+        for (size_t batch = 0; batch < batches_cnt; ++batch) {
+            for (size_t key = gen() % 64; key > 0; --key) {
+                expected.push_back(static_cast<int>(gen() % 1000));
+            }
+        }
+    }
+    for (const auto &keys: popped) {
+        actual.insert(actual.end(), keys.begin(), keys.end());
+    }
+    std::sort(expected.begin(), expected.end());
+    std::sort(actual.begin(), actual.end());
+    EXPECT_EQ(actual, expected);
+    EXPECT_EQ(channel.Size(), 0u);
+}
+
+TEST(PriorityChannel, Threads) {
+    TestPriorityChannel<heaps::LeftistHeap>(4, 3, 500);
+    TestPriorityChannel<heaps::BinomialHeap>(2, 4, 500);
+    TestPriorityChannel<heaps::StlHeap>(3, 1, 200);
+}
+
+TEST(PriorityChannel, WaitersGetMinima) {
+    heaps::PriorityChannel<int> channel;
+    std::vector<int> popped(3);
+    std::vector<std::thread> consumers;
+    for (size_t i = 0; i < popped.size(); ++i) {
+        consumers.emplace_back([&channel, &key = popped[i]] { key = channel.Pop().value_or(-1); });
+        while (channel.WaitersCount() != i + 1) {
+            std::this_thread::yield();
+        }
+    }
+    channel.PushBatch(std::vector<int>{8, 5, 3, 9, 4});
+    for (auto &consumer: consumers) {
+        consumer.join();
+    }
+    EXPECT_EQ(popped, (std::vector<int>{3, 4, 5}));
+    EXPECT_EQ(channel.WaitersCount(), 0u);
+    EXPECT_EQ(channel.TryPop(), 8);
+    channel.Close();
+    EXPECT_EQ(channel.Pop(), 9);
+    EXPECT_EQ(channel.Pop(), std::nullopt);
+    EXPECT_EQ(channel.TryPop(), std::nullopt);
+}
+
+#ifdef MERGEABLE_HEAPS_HAS_COROUTINES
+// Coroutine, which runs until the first suspension at the call and is destroyed at the end.
+struct DetachedCoroutine {
+    struct promise_type {
+        DetachedCoroutine get_return_object() {
+            return {};
+        }
+
+        std::suspend_never initial_suspend() noexcept {
+            return {};
+        }
+
+        std::suspend_never final_suspend() noexcept {
+            return {};
+        }
+
+        void return_void() {}
+
+        void unhandled_exception() {
+            std::terminate();
+        }
+    };
+};
+
+DetachedCoroutine Consume(heaps::PriorityChannel<int> &channel, std::vector<int> &popped) {
+    while (auto key = co_await channel.AsyncPop()) {
+        popped.push_back(*key);
+    }
+    popped.push_back(-1);
+}
+
+DetachedCoroutine Produce(heaps::PriorityChannel<int> &channel, std::vector<std::vector<int>> batches) {
+    for (const auto &batch: batches) {
+        co_await channel.AsyncPushBatch(batch);
+    }
+}
+
+TEST(PriorityChannel, Coroutines) {
+    heaps::PriorityChannel<int> channel;
+    std::vector<int> popped;
+    Consume(channel, popped);
+    Consume(channel, popped);
+    EXPECT_EQ(channel.WaitersCount(), 2u);
+    // Every resumed consumer pops again: it takes the key left in the channel or waits at the end of the queue.
+    Produce(channel, {{7, 2}, {5, 1, 6}});
+    EXPECT_EQ(popped, (std::vector<int>{2, 7, 1, 6, 5}));
+    EXPECT_EQ(channel.WaitersCount(), 2u);
+    channel.Close();
+    EXPECT_EQ(popped, (std::vector<int>{2, 7, 1, 6, 5, -1, -1}));
+    EXPECT_EQ(channel.WaitersCount(), 0u);
+}
+#endif
+
+// Name of a shared memory object, which is unique to the test process
+std::string SharedMemoryName(const std::string &test) {
+    return "/mergeable_heaps_" + test + "_" + std::to_string(getpid());
+}
+
+// Forked processes insert into the shared heap 0 and into their own heaps, which are melded into the heap 0,
+// and move the keys from the heap 0 into the heap 1. No key is lost or duplicated.
+template<template<class> class Heap>
+void TestSharedMemoryProcesses(size_t processes_cnt, int keys_cnt) {
+    using SharedHeap = heaps::SharedMemoryHeap<int, Heap>;
+    const std::string name = SharedMemoryName("processes");
+    auto common = SharedHeap::Create(name, processes_cnt * keys_cnt, processes_cnt + 2);
+    auto key_of = [keys_cnt](size_t process, int i) {
+        return static_cast<int>(process) * keys_cnt + i * 7919 % keys_cnt;
+    };
+    std::vector<pid_t> children;
+    for (size_t process = 0; process < processes_cnt; ++process) {
+        const pid_t pid = fork();
+        if (pid == 0) {
+            int status = 0;
+            try {
+                auto shared = SharedHeap::Open(name);
+                auto popped = shared.Sibling(1);
+                auto own = shared.Sibling(process + 2);
+                for (int i = 0; i < keys_cnt; ++i) {
+                    (i % 2 == 0 ? own : shared).Insert(key_of(process, i));
+                    if (i % 4 == 3) {
+                        if (auto key = shared.TakeMinimum()) {
+                            popped.Insert(*key);
+                        }
+                    }
+                }
+                for (int i = 0; i < keys_cnt / 8; ++i) {
+                    own.ExtractMinimum();
+                }
+                shared.Merge(own);
+            } catch (...) {
+                status = 1;
+            }
+            _exit(status);
+        }
+        ASSERT_GT(pid, 0);
+        children.push_back(pid);
+    }
+    for (pid_t pid: children) {
+        int status = 0;
+        ASSERT_EQ(waitpid(pid, &status, 0), pid);
+        EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    }
+    std::vector<int> expected;
+    for (size_t process = 0; process < processes_cnt; ++process) {
+        std::vector<int> own;
+        for (int i = 0; i < keys_cnt; ++i) {
+            (i % 2 == 0 ? own : expected).push_back(key_of(process, i));
+        }
+        std::sort(own.begin(), own.end());
+        expected.insert(expected.end(), own.begin() + keys_cnt / 8, own.end());
+        EXPECT_TRUE(common.Sibling(process + 2).Empty());
+    }
+    auto popped = common.Sibling(1);
+    std::vector<int> actual = common.Data(), popped_keys = popped.Data();
+    EXPECT_FALSE(popped_keys.empty());
+    actual.insert(actual.end(), popped_keys.begin(), popped_keys.end());
+    std::sort(actual.begin(), actual.end());
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(actual, expected);
+    EXPECT_EQ(common.Size() + popped.Size(), expected.size());
+    int previous = std::numeric_limits<int>::min();
+    while (auto key = common.TakeMinimum()) {
+        ASSERT_LE(previous, *key);
+        previous = *key;
+    }
+    SharedHeap::Unlink(name);
+}
+
+TEST(SharedMemoryHeap, LeftistProcesses) {
+    TestSharedMemoryProcesses<heaps::LeftistHeap>(4, 2000);
+}
+
+TEST(SharedMemoryHeap, SkewProcesses) {
+    TestSharedMemoryProcesses<heaps::SkewHeap>(4, 2000);
+}
+
+TEST(SharedMemoryHeap, Segment) {
+    using SharedHeap = heaps::SharedMemoryHeap<int64_t, heaps::SkewHeap>;
+    const std::string name = SharedMemoryName("segment");
+    auto first = SharedHeap::Create(name, 100, 2);
+    EXPECT_THROW(SharedHeap::Create(name, 100), std::system_error);
+    EXPECT_THROW(SharedHeap::Open(name, 2), heaps::SharedHeapLayoutException);
+    EXPECT_THROW((heaps::SharedMemoryHeap<int64_t, heaps::LeftistHeap>::Open(name)), heaps::SharedHeapLayoutException);
+    EXPECT_THROW(heaps::SharedMemoryHeap<int>::Open(name), heaps::SharedHeapLayoutException);
+    // The second mapping is at another address, the nodes are linked by their offsets.
+    auto second = SharedHeap::Open(name, 1);
+    for (int64_t key = 0; key < 100; ++key) {
+        (key % 2 == 0 ? first : second).Insert(99 - key);
+    }
+    EXPECT_THROW(first.Insert(100), heaps::SharedHeapFullException);
+    EXPECT_EQ(first.Sibling(1).GetMinimum(), 0);
+    EXPECT_THROW(first.Merge(first), heaps::SelfHeapMergeException);
+    EXPECT_THROW(second.Merge(*std::make_unique<SharedHeap>(SharedHeap::Open(name, 1))),
+                 heaps::SelfHeapMergeException);
+    heaps::LeftistHeap<int64_t> other;
+    EXPECT_THROW(first.Merge(other), heaps::WrongHeapTypeException);
+    first.Merge(second);
+    EXPECT_TRUE(second.Empty());
+    EXPECT_EQ(first.Size(), 100u);
+    EXPECT_EQ(first.TakeMinimum(), 0);
+    first.ExtractMinimum();
+    EXPECT_EQ(first.GetMinimum(), 2);
+    first.Clear();
+    EXPECT_EQ(second.TakeMinimum(), std::nullopt);
+    EXPECT_THROW(first.ExtractMinimum(), heaps::EmptyHeapException);
+    for (int64_t key = 0; key < 100; ++key) {
+        second.Insert(key);
+    }
+    EXPECT_EQ(second.Data().size(), 100u);
+    SharedHeap::Unlink(name);
+    EXPECT_THROW(SharedHeap::Open(name), std::system_error);
+    EXPECT_EQ(second.GetMinimum(), 0);
+}
+
+// A process killed at a random moment doesn't deadlock the others: the robust mutex is recovered,
+// and the heaps are either consistent or reported as corrupted.
+TEST(SharedMemoryHeap, KilledProcess) {
+    using SharedHeap = heaps::SharedMemoryHeap<int>;
+    const std::string name = SharedMemoryName("killed");
+    auto heap = SharedHeap::Create(name, 1 << 12);
+    SharedHeap::Unlink(name);
+    const pid_t pid = fork();
+    if (pid == 0) {
+        for (int i = 0;; ++i) {
+            heap.Insert(i * 7919 % 4096);
+            if (heap.Size() > 1000) {
+                heap.ExtractMinimum();
+            }
+        }
+    }
+    ASSERT_GT(pid, 0);
+    while (heap.Size() < 1000) {
+        std::this_thread::yield();
+    }
+    kill(pid, SIGKILL);
+    ASSERT_EQ(waitpid(pid, nullptr, 0), pid);
+    try {
+        EXPECT_EQ(heap.Data().size(), heap.Size());
+        heap.Insert(0);
+        EXPECT_EQ(heap.GetMinimum(), 0);
+    } catch (const heaps::CorruptedSharedHeapException &) {
+        EXPECT_THROW(heap.Size(), heaps::CorruptedSharedHeapException);
+    }
+}
+
+// The parallel drain writes the keys in the order of the sequential extraction and leaves the heap empty.
+template<typename T>
+void TestDrainSorted(size_t keys_cnt) {
+    std::mt19937 gen(48);
+    for (size_t threads_cnt: {1u, 4u}) {
+        T heap, other;
+        for (size_t i = 0; i < keys_cnt; ++i) {
+            auto key = static_cast<int64_t>(gen() % (keys_cnt / 2 + 1));
+            (i % 3 == 0 ? other : heap).Insert(key);
+        }
+        heap.Merge(other);
+        heap.Insert(-1);
+        T copy(heap);
+        std::vector<int64_t> expected;
+        while (!copy.Empty()) {
+            expected.push_back(copy.GetMinimum());
+            copy.ExtractMinimum();
+        }
+        std::vector<int64_t> keys(expected.size());
+        EXPECT_EQ(heap.DrainSorted(keys.begin(), threads_cnt), keys.end());
+        EXPECT_EQ(keys, expected);
+        EXPECT_TRUE(heap.Empty());
+        EXPECT_EQ(heap.Size(), 0u);
+
+        heap.Merge(copy);
+        for (auto key: expected) {
+            heap.Insert(key);
+        }
+        std::vector<int64_t> inserted;
+        heap.DrainSorted(std::back_inserter(inserted), threads_cnt);
+        EXPECT_EQ(inserted, expected);
+        EXPECT_THROW(heap.ExtractMinimum(), heaps::EmptyHeapException);
+    }
+}
+
+TEST(DrainSorted, TreeHeaps) {
+    TestDrainSorted<heaps::LeftistHeap<int64_t>>(100'000);
+    TestDrainSorted<heaps::SkewHeap<int64_t>>(100'000);
+    TestDrainSorted<heaps::BinomialHeap<int64_t>>(100'000);
+    TestDrainSorted<heaps::LeftistHeap<int64_t, 8, true>>(1000);
+    TestDrainSorted<heaps::BinomialHeap<int64_t, 16, true>>(1000);
+    TestDrainSorted<heaps::SkewHeap<int64_t>>(5);
+    // The lazy deltas are pushed down on the way.
+    heaps::SkewHeap<int64_t> shifted;
+    std::vector<int64_t> expected;
+    for (int64_t i = 0; i < 1000; ++i) {
+        shifted.Insert(i * 7919 % 1000);
+        shifted.AddToAll(1);
+        expected.push_back(i * 7919 % 1000 + 1000 - i);
+    }
+    std::sort(expected.begin(), expected.end());
+    std::vector<int64_t> keys;
+    shifted.DrainSorted(std::back_inserter(keys), 4);
+    EXPECT_EQ(keys, expected);
+}
+
 TEST_F(TestCase, StlHeapTest) {
     TestHeap<heaps::StlHeap<SimpleKey>>(actions_);
 }
\ No newline at end of file